@@ -0,0 +1,73 @@
+// Micro-benchmark for the CSC assembly used by highs_solve.
+//
+// Generates random sparse models of increasing size, times
+// AssembleColwiseMatrix for the single-threaded and parallel paths, and
+// prints one CSV line per run:
+//
+//   nnz,num_row,num_col,threads,seconds
+
+#include "highs_matrix.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <thread>
+#include <vector>
+
+using duckdb::AssembleColwiseMatrix;
+using duckdb::HighsCoefficientStore;
+using duckdb::HighsColwiseMatrix;
+
+static double TimeAssembly(HighsInt num_col,
+                           const HighsCoefficientStore &coefficients,
+                           size_t threads, int repetitions) {
+  double best = 0.0;
+  for (int r = 0; r < repetitions; r++) {
+    HighsColwiseMatrix matrix;
+    auto begin = std::chrono::steady_clock::now();
+    AssembleColwiseMatrix(num_col, coefficients, matrix, threads);
+    auto end = std::chrono::steady_clock::now();
+    double seconds = std::chrono::duration<double>(end - begin).count();
+    if (r == 0 || seconds < best) {
+      best = seconds;
+    }
+  }
+  return best;
+}
+
+int main(int argc, char **argv) {
+  size_t max_nnz = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10000000;
+  int repetitions = argc > 2 ? std::atoi(argv[2]) : 3;
+  size_t hw_threads = std::max(1u, std::thread::hardware_concurrency());
+
+  // Transport-like shape: short rows, roughly 2.5 variables per constraint
+  const size_t row_nnz = 4;
+  std::mt19937_64 rng(42);
+
+  std::printf("nnz,num_row,num_col,threads,seconds\n");
+  for (size_t nnz = 10000; nnz <= max_nnz; nnz *= 10) {
+    size_t num_row = nnz / row_nnz;
+    HighsInt num_col = (HighsInt)(num_row * 10 / 4);
+    std::uniform_int_distribution<int> col_dist(0, num_col - 1);
+    std::uniform_real_distribution<double> value_dist(-10.0, 10.0);
+
+    HighsCoefficientStore coefficients;
+    for (size_t row = 0; row < num_row; row++) {
+      for (size_t k = 0; k < row_nnz; k++) {
+        coefficients.Append((int)row, col_dist(rng), value_dist(rng));
+      }
+    }
+
+    for (size_t threads : {(size_t)1, hw_threads}) {
+      double seconds =
+          TimeAssembly(num_col, coefficients, threads, repetitions);
+      std::printf("%zu,%zu,%d,%zu,%.6f\n", nnz, num_row, (int)num_col,
+                  threads, seconds);
+      if (hw_threads == 1) {
+        break;
+      }
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,234 @@
+// Phase-level benchmark for the extension.
+//
+// Generates transport, assignment, network-flow and facility-location
+// models with the SQL scripts in benchmark/sql, at sizes from 1k nonzeros
+// up to --max-nnz in steps of 10x, and times each phase of getting a model
+// through the extension separately:
+//
+//   variables     highs_create_variables over a generated table
+//   constraints   highs_create_constraints over a generated table
+//   coefficients  highs_set_coefficients over a generated table
+//   assembly      AssembleLp on the registered model (CSC build)
+//   solve         first highs_solve scan with every row filtered out:
+//                 solver build (which repeats the assembly) plus HiGHS
+//   emission      second highs_solve scan, served from the cached result
+//
+// Generation time is excluded. One CSV line per run goes to --output:
+//
+//   family,size,num_variables,num_constraints,nnz,variables,constraints,
+//   coefficients,assembly,solve,emission,status
+//
+// Usage: highs_phase_benchmark [--output FILE] [--sql-dir DIR]
+//          [--min-nnz N] [--max-nnz N] [--time-limit SECONDS]
+//          [--families transport,assignment,network_flow,facility_location]
+
+#include "duckdb.hpp"
+#include "highs_extension.hpp"
+#include "highs_model.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using duckdb::Connection;
+using duckdb::DuckDB;
+using duckdb::HighsModelRegistry;
+using duckdb::HighsSharedLock;
+
+namespace {
+
+struct Family {
+  const char *name;
+  // Generator size parameter n for a target number of nonzeros
+  size_t (*SizeForNnz)(double nnz);
+};
+
+size_t Clamp(double n) { return n < 2 ? 2 : (size_t)std::lround(n); }
+
+const Family kFamilies[] = {
+    {"transport", [](double nnz) { return Clamp(std::sqrt(nnz / 2)); }},
+    {"assignment", [](double nnz) { return Clamp(std::sqrt(nnz / 2)); }},
+    {"network_flow", [](double nnz) { return Clamp(std::sqrt(nnz / 8)); }},
+    {"facility_location",
+     [](double nnz) { return Clamp(std::sqrt(nnz / 30)); }},
+};
+
+struct Options {
+  std::string output = "highs_phase_benchmark.csv";
+  std::string sql_dir = "benchmark/sql";
+  double min_nnz = 1e3;
+  double max_nnz = 1e7;
+  double time_limit = 60;
+  std::string families = "transport,assignment,network_flow,facility_location";
+};
+
+std::string ReadFile(const std::string &path) {
+  std::ifstream in(path);
+  if (!in) {
+    throw std::runtime_error("Cannot read " + path);
+  }
+  std::stringstream buffer;
+  buffer << in.rdbuf();
+  return buffer.str();
+}
+
+duckdb::unique_ptr<duckdb::MaterializedQueryResult>
+Run(Connection &con, const std::string &sql) {
+  auto result = con.Query(sql);
+  if (result->HasError()) {
+    throw std::runtime_error(result->GetError() + "\n  in: " + sql);
+  }
+  return result;
+}
+
+// Seconds taken by fn()
+template <class F> double Time(F fn) {
+  auto begin = std::chrono::steady_clock::now();
+  fn();
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double>(end - begin).count();
+}
+
+int64_t Count(Connection &con, const std::string &table) {
+  return Run(con, "SELECT count(*) FROM " + table)
+      ->GetValue(0, 0)
+      .GetValue<int64_t>();
+}
+
+void RunFamily(Connection &con, const Options &options, const Family &family,
+               std::FILE *output) {
+  std::string script =
+      ReadFile(options.sql_dir + "/" + family.name + ".sql");
+  size_t threads = std::max(1u, std::thread::hardware_concurrency());
+  size_t previous_size = 0;
+  for (double nnz = options.min_nnz; nnz <= options.max_nnz; nnz *= 10) {
+    size_t size = family.SizeForNnz(nnz);
+    if (size == previous_size) {
+      continue;
+    }
+    previous_size = size;
+    std::string model = std::string("bench_") + family.name + "_" +
+                        std::to_string(size);
+
+    Run(con, "SET VARIABLE model = '" + model + "'");
+    Run(con, "SET VARIABLE n = " + std::to_string(size));
+    Run(con, script);
+    Run(con, "SELECT * FROM highs_set_option('" + model + "', 'time_limit', '" +
+                 std::to_string(options.time_limit) + "')");
+    Run(con, "SELECT * FROM highs_set_option('" + model +
+                 "', 'output_flag', 'false')");
+    auto num_variables = Count(con, "bench_variables");
+    auto num_constraints = Count(con, "bench_constraints");
+    auto num_nonzeros = Count(con, "bench_coefficients");
+
+    double variables = Time([&]() {
+      Run(con, "SELECT count(*) FROM highs_create_variables("
+               "(SELECT * FROM bench_variables))");
+    });
+    double constraints = Time([&]() {
+      Run(con, "SELECT count(*) FROM highs_create_constraints("
+               "(SELECT * FROM bench_constraints))");
+    });
+    double coefficients = Time([&]() {
+      Run(con, "SELECT count(*) FROM highs_set_coefficients("
+               "(SELECT * FROM bench_coefficients))");
+    });
+    double assembly = Time([&]() {
+      auto model_info = HighsModelRegistry::Instance().GetModel(model);
+      HighsSharedLock guard(model_info->mutex);
+      model_info->AssembleLp(threads);
+    });
+    double solve = Time([&]() {
+      Run(con, "SELECT count(*) FROM highs_solve('" + model +
+                   "') WHERE column_index < 0");
+    });
+    std::string status;
+    double emission = Time([&]() {
+      auto result = Run(con, "SELECT sum(solution_value), any_value(status) "
+                             "FROM highs_solve('" + model + "')");
+      status = result->GetValue(1, 0).ToString();
+    });
+
+    std::fprintf(output,
+                 "%s,%zu,%lld,%lld,%lld,%.6f,%.6f,%.6f,%.6f,%.6f,%.6f,%s\n",
+                 family.name, size, (long long)num_variables,
+                 (long long)num_constraints, (long long)num_nonzeros,
+                 variables, constraints, coefficients, assembly, solve,
+                 emission, status.c_str());
+    std::fflush(output);
+    std::fprintf(stderr, "%s n=%zu nnz=%lld solve=%.3fs %s\n", family.name,
+                 size, (long long)num_nonzeros, solve, status.c_str());
+
+    HighsModelRegistry::Instance().RemoveModel(model);
+  }
+  Run(con, "DROP TABLE IF EXISTS bench_variables");
+  Run(con, "DROP TABLE IF EXISTS bench_constraints");
+  Run(con, "DROP TABLE IF EXISTS bench_coefficients");
+  Run(con, "DROP TABLE IF EXISTS bench_arcs");
+}
+
+Options ParseOptions(int argc, char **argv) {
+  Options options;
+  for (int i = 1; i + 1 < argc; i += 2) {
+    std::string flag = argv[i];
+    std::string value = argv[i + 1];
+    if (flag == "--output") {
+      options.output = value;
+    } else if (flag == "--sql-dir") {
+      options.sql_dir = value;
+    } else if (flag == "--min-nnz") {
+      options.min_nnz = std::atof(value.c_str());
+    } else if (flag == "--max-nnz") {
+      options.max_nnz = std::atof(value.c_str());
+    } else if (flag == "--time-limit") {
+      options.time_limit = std::atof(value.c_str());
+    } else if (flag == "--families") {
+      options.families = value;
+    } else {
+      throw std::runtime_error("Unknown option " + flag);
+    }
+  }
+  return options;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  try {
+    Options options = ParseOptions(argc, argv);
+    DuckDB db(nullptr);
+    db.LoadStaticExtension<duckdb::HighsExtension>();
+    Connection con(db);
+    // Every solve must reach HiGHS
+    Run(con, "SET highs_result_cache_size = 0");
+
+    std::FILE *output = std::fopen(options.output.c_str(), "w");
+    if (!output) {
+      throw std::runtime_error("Cannot write " + options.output);
+    }
+    std::fprintf(output, "family,size,num_variables,num_constraints,nnz,"
+                         "variables,constraints,coefficients,assembly,"
+                         "solve,emission,status\n");
+    for (auto &family : kFamilies) {
+      if (("," + options.families + ",")
+              .find(std::string(",") + family.name + ",") ==
+          std::string::npos) {
+        continue;
+      }
+      RunFamily(con, options, family, output);
+    }
+    std::fclose(output);
+  } catch (const std::exception &e) {
+    std::fprintf(stderr, "%s\n", e.what());
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,29 @@
+-- Assignment problem: n workers, n tasks, each worker does exactly one task
+-- and each task is done once. The LP relaxation is integral.
+-- Variables n^2, constraints 2n, nonzeros 2n^2.
+-- Parameters: getvariable('model'), getvariable('n')
+
+CREATE OR REPLACE TEMP TABLE bench_variables AS
+SELECT getvariable('model') AS model_name,
+       'x_' || i || '_' || j AS variable_name,
+       0.0 AS lower_bound,
+       1.0 AS upper_bound,
+       (hash(j, i) % 1000 + 1)::DOUBLE AS obj_coefficient,
+       'continuous' AS var_type
+FROM range(getvariable('n')) w(i), range(getvariable('n')) t(j);
+
+CREATE OR REPLACE TEMP TABLE bench_constraints AS
+SELECT getvariable('model') AS model_name, 'worker_' || i AS constraint_name,
+       1.0 AS lower_bound, 1.0 AS upper_bound
+FROM range(getvariable('n')) w(i)
+UNION ALL
+SELECT getvariable('model'), 'task_' || j, 1.0, 1.0
+FROM range(getvariable('n')) t(j);
+
+CREATE OR REPLACE TEMP TABLE bench_coefficients AS
+SELECT getvariable('model') AS model_name, 'worker_' || i AS constraint_name,
+       'x_' || i || '_' || j AS variable_name, 1.0 AS coefficient
+FROM range(getvariable('n')) w(i), range(getvariable('n')) t(j)
+UNION ALL
+SELECT getvariable('model'), 'task_' || j, 'x_' || i || '_' || j, 1.0
+FROM range(getvariable('n')) w(i), range(getvariable('n')) t(j);
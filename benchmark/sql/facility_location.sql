@@ -0,0 +1,35 @@
+-- Uncapacitated facility location MIP: n facilities with a binary open
+-- decision and 10n customers, each served by open facilities only.
+-- Variables n + 10n^2, constraints 10n + 10n^2, nonzeros 30n^2.
+-- Parameters: getvariable('model'), getvariable('n')
+
+CREATE OR REPLACE TEMP TABLE bench_variables AS
+SELECT getvariable('model') AS model_name, 'open_' || i AS variable_name,
+       0.0 AS lower_bound, 1.0 AS upper_bound,
+       (hash(i) % 1000 + 500)::DOUBLE AS obj_coefficient,
+       'binary' AS var_type
+FROM range(getvariable('n')) f(i)
+UNION ALL
+SELECT getvariable('model'), 'serve_' || i || '_' || j, 0.0, 1.0,
+       (hash(i, j) % 100 + 1)::DOUBLE, 'continuous'
+FROM range(getvariable('n')) f(i), range(10 * getvariable('n')) c(j);
+
+CREATE OR REPLACE TEMP TABLE bench_constraints AS
+SELECT getvariable('model') AS model_name, 'demand_' || j AS constraint_name,
+       1.0 AS lower_bound, 1.0 AS upper_bound
+FROM range(10 * getvariable('n')) c(j)
+UNION ALL
+SELECT getvariable('model'), 'link_' || i || '_' || j, -1e30, 0.0
+FROM range(getvariable('n')) f(i), range(10 * getvariable('n')) c(j);
+
+CREATE OR REPLACE TEMP TABLE bench_coefficients AS
+SELECT getvariable('model') AS model_name, 'demand_' || j AS constraint_name,
+       'serve_' || i || '_' || j AS variable_name, 1.0 AS coefficient
+FROM range(getvariable('n')) f(i), range(10 * getvariable('n')) c(j)
+UNION ALL
+SELECT getvariable('model'), 'link_' || i || '_' || j,
+       'serve_' || i || '_' || j, 1.0
+FROM range(getvariable('n')) f(i), range(10 * getvariable('n')) c(j)
+UNION ALL
+SELECT getvariable('model'), 'link_' || i || '_' || j, 'open_' || i, -1.0
+FROM range(getvariable('n')) f(i), range(10 * getvariable('n')) c(j);
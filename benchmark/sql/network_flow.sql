@@ -0,0 +1,46 @@
+-- Min-cost flow on an n x n grid: arcs both ways between neighbouring
+-- nodes, n units sent from the top-left to the bottom-right corner.
+-- Variables ~4n^2 arcs, constraints n^2 node balances, nonzeros ~8n^2.
+-- Parameters: getvariable('model'), getvariable('n')
+
+CREATE OR REPLACE TEMP TABLE bench_arcs AS
+WITH nodes AS (
+  SELECT r, c FROM range(getvariable('n')) a(r), range(getvariable('n')) b(c)
+), steps AS (
+  SELECT * FROM (VALUES (0, 1), (1, 0), (0, -1), (-1, 0)) s(dr, dc)
+)
+SELECT r * getvariable('n') + c AS tail,
+       (r + dr) * getvariable('n') + c + dc AS head
+FROM nodes, steps
+WHERE r + dr BETWEEN 0 AND getvariable('n') - 1
+  AND c + dc BETWEEN 0 AND getvariable('n') - 1;
+
+CREATE OR REPLACE TEMP TABLE bench_variables AS
+SELECT getvariable('model') AS model_name,
+       'f_' || tail || '_' || head AS variable_name,
+       0.0 AS lower_bound,
+       getvariable('n')::DOUBLE AS upper_bound,
+       (hash(tail, head) % 50 + 1)::DOUBLE AS obj_coefficient,
+       'continuous' AS var_type
+FROM bench_arcs;
+
+-- Outflow minus inflow: +n at the source, -n at the sink, 0 elsewhere
+CREATE OR REPLACE TEMP TABLE bench_constraints AS
+SELECT getvariable('model') AS model_name, 'node_' || v AS constraint_name,
+       balance AS lower_bound, balance AS upper_bound
+FROM (
+  SELECT v, CASE WHEN v = 0 THEN getvariable('n')::DOUBLE
+                 WHEN v = getvariable('n') * getvariable('n') - 1
+                   THEN -getvariable('n')::DOUBLE
+                 ELSE 0.0 END AS balance
+  FROM range(getvariable('n') * getvariable('n')) t(v)
+);
+
+CREATE OR REPLACE TEMP TABLE bench_coefficients AS
+SELECT getvariable('model') AS model_name, 'node_' || tail AS constraint_name,
+       'f_' || tail || '_' || head AS variable_name, 1.0 AS coefficient
+FROM bench_arcs
+UNION ALL
+SELECT getvariable('model'), 'node_' || head, 'f_' || tail || '_' || head,
+       -1.0
+FROM bench_arcs;
@@ -0,0 +1,29 @@
+-- Transportation problem: n sources with supply 20, n sinks with demand 10,
+-- one shipment variable per (source, sink) pair.
+-- Variables n^2, constraints 2n, nonzeros 2n^2.
+-- Parameters: getvariable('model'), getvariable('n')
+
+CREATE OR REPLACE TEMP TABLE bench_variables AS
+SELECT getvariable('model') AS model_name,
+       'x_' || i || '_' || j AS variable_name,
+       0.0 AS lower_bound,
+       1e30 AS upper_bound,
+       (hash(i, j) % 100 + 1)::DOUBLE AS obj_coefficient,
+       'continuous' AS var_type
+FROM range(getvariable('n')) s(i), range(getvariable('n')) t(j);
+
+CREATE OR REPLACE TEMP TABLE bench_constraints AS
+SELECT getvariable('model') AS model_name, 'supply_' || i AS constraint_name,
+       -1e30 AS lower_bound, 20.0 AS upper_bound
+FROM range(getvariable('n')) s(i)
+UNION ALL
+SELECT getvariable('model'), 'demand_' || j, 10.0, 10.0
+FROM range(getvariable('n')) t(j);
+
+CREATE OR REPLACE TEMP TABLE bench_coefficients AS
+SELECT getvariable('model') AS model_name, 'supply_' || i AS constraint_name,
+       'x_' || i || '_' || j AS variable_name, 1.0 AS coefficient
+FROM range(getvariable('n')) s(i), range(getvariable('n')) t(j)
+UNION ALL
+SELECT getvariable('model'), 'demand_' || j, 'x_' || i || '_' || j, 1.0
+FROM range(getvariable('n')) s(i), range(getvariable('n')) t(j);
@@ -0,0 +1,74 @@
+#include "highs_cache.hpp"
+
+namespace duckdb {
+
+constexpr idx_t HighsResultCache::kDefaultCapacity;
+
+HighsResultCache &HighsResultCache::Instance() {
+  static HighsResultCache instance;
+  return instance;
+}
+
+std::shared_ptr<const HighsSolveResult>
+HighsResultCache::Lookup(const HighsFingerprint &fingerprint) {
+  std::lock_guard<std::mutex> guard(mutex);
+  auto it = index.find(fingerprint.hash);
+  if (it == index.end() || !(it->second->first == fingerprint)) {
+    misses++;
+    return nullptr;
+  }
+  hits++;
+  entries.splice(entries.begin(), entries, it->second);
+  return it->second->second;
+}
+
+void HighsResultCache::Insert(const HighsFingerprint &fingerprint,
+                              std::shared_ptr<const HighsSolveResult> result) {
+  std::lock_guard<std::mutex> guard(mutex);
+  if (capacity == 0) {
+    return;
+  }
+  auto it = index.find(fingerprint.hash);
+  if (it != index.end()) {
+    it->second->first = fingerprint;
+    it->second->second = std::move(result);
+    entries.splice(entries.begin(), entries, it->second);
+    return;
+  }
+  entries.emplace_front(fingerprint, std::move(result));
+  index[fingerprint.hash] = entries.begin();
+  EvictBeyond(capacity);
+}
+
+void HighsResultCache::SetCapacity(idx_t new_capacity) {
+  std::lock_guard<std::mutex> guard(mutex);
+  capacity = new_capacity;
+  EvictBeyond(capacity);
+}
+
+void HighsResultCache::EvictBeyond(idx_t limit) {
+  while (entries.size() > limit) {
+    index.erase(entries.back().first.hash);
+    entries.pop_back();
+    evictions++;
+  }
+}
+
+HighsResultCacheStats HighsResultCache::Stats() {
+  std::lock_guard<std::mutex> guard(mutex);
+  HighsResultCacheStats stats;
+  stats.entries = entries.size();
+  stats.capacity = capacity;
+  stats.hits = hits;
+  stats.misses = misses;
+  stats.evictions = evictions;
+  return stats;
+}
+
+void SetHighsResultCacheSize(ClientContext &context, SetScope scope,
+                             Value &parameter) {
+  HighsResultCache::Instance().SetCapacity(
+      (idx_t)parameter.GetValue<uint64_t>());
+}
+
+} // namespace duckdb
@@ -0,0 +1,411 @@
+#include "highs_decompose.hpp"
+#include "highs_matrix.hpp"
+#include "highs_monitor.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+namespace duckdb {
+
+namespace {
+
+// Union-find over column indices with path halving and union by size
+class ColumnUnion {
+public:
+  explicit ColumnUnion(idx_t count) : parent(count), size(count, 1) {
+    for (idx_t i = 0; i < count; i++) {
+      parent[i] = (int)i;
+    }
+  }
+
+  int Find(int col) {
+    while (parent[col] != col) {
+      parent[col] = parent[parent[col]];
+      col = parent[col];
+    }
+    return col;
+  }
+
+  void Union(int a, int b) {
+    a = Find(a);
+    b = Find(b);
+    if (a == b) {
+      return;
+    }
+    if (size[a] < size[b]) {
+      std::swap(a, b);
+    }
+    parent[b] = a;
+    size[a] += size[b];
+  }
+
+private:
+  std::vector<int> parent;
+  std::vector<idx_t> size;
+};
+
+// A block's sub-LP and where its solution goes in the model
+struct BlockProblem {
+  HighsBlock block;
+  // The block's coefficients in local indices, until its LP is built
+  std::vector<int> row_index;
+  std::vector<int> col_index;
+  std::vector<double> value;
+  HighsLp lp;
+  idx_t work = 0; // columns plus nonzeros, for scheduling
+
+  HighsModelStatus model_status = HighsModelStatus::kNotset;
+  double objective_value = 0.0;
+  HighsSolution solution;
+  HighsSolveProfile profile; // counters only; blocks overlap in time
+  std::string error;
+};
+
+// How far from optimal a status is, for reporting the worst block
+int StatusRank(HighsModelStatus status) {
+  switch (status) {
+  case HighsModelStatus::kOptimal:
+    return 0;
+  case HighsModelStatus::kTimeLimit:
+  case HighsModelStatus::kIterationLimit:
+  case HighsModelStatus::kSolutionLimit:
+    return 1;
+  case HighsModelStatus::kUnbounded:
+  case HighsModelStatus::kUnboundedOrInfeasible:
+    return 3;
+  case HighsModelStatus::kInfeasible:
+    return 4;
+  case HighsModelStatus::kInterrupt:
+    return 5;
+  default:
+    return 2;
+  }
+}
+
+void BuildBlockLp(const HighsModelInfo &model_info, BlockProblem &problem) {
+  auto &block = problem.block;
+  HighsLp &lp = problem.lp;
+  idx_t num_col = block.columns.size();
+  idx_t num_row = block.rows.size();
+  lp.sense_ = model_info.model.lp_.sense_;
+  lp.num_col_ = (HighsInt)num_col;
+  lp.num_row_ = (HighsInt)num_row;
+  lp.col_cost_.resize(num_col);
+  lp.col_lower_.resize(num_col);
+  lp.col_upper_.resize(num_col);
+  std::vector<HighsVariableType> variable_types(num_col);
+  for (idx_t i = 0; i < num_col; i++) {
+    int col = block.columns[i];
+    lp.col_cost_[i] = model_info.obj_coefficients[col];
+    lp.col_lower_[i] = model_info.var_lower_bounds[col];
+    lp.col_upper_[i] = model_info.var_upper_bounds[col];
+    variable_types[i] = model_info.variable_types[col];
+  }
+
+  lp.row_lower_.resize(num_row);
+  lp.row_upper_.resize(num_row);
+  for (idx_t i = 0; i < num_row; i++) {
+    int row = block.rows[i];
+    lp.row_lower_[i] = model_info.constraint_lower_bounds[row];
+    lp.row_upper_[i] = model_info.constraint_upper_bounds[row];
+  }
+
+  HighsColwiseMatrix matrix;
+  idx_t nnz = problem.value.size();
+  AssembleColwiseMatrix((HighsInt)num_col, problem.row_index.data(),
+                        problem.col_index.data(), problem.value.data(), nnz,
+                        matrix);
+  problem.row_index = std::vector<int>();
+  problem.col_index = std::vector<int>();
+  problem.value = std::vector<double>();
+  lp.a_matrix_.format_ = MatrixFormat::kColwise;
+  lp.a_matrix_.num_col_ = (HighsInt)num_col;
+  lp.a_matrix_.num_row_ = (HighsInt)num_row;
+  lp.a_matrix_.start_ = std::move(matrix.start);
+  lp.a_matrix_.index_ = std::move(matrix.index);
+  lp.a_matrix_.value_ = std::move(matrix.value);
+  SetIntegrality(variable_types, lp);
+  problem.work = num_col + nnz;
+}
+
+void SolveBlock(BlockProblem &problem, const HighsOptionProfile &options,
+                const HighsThreadSettings &settings, idx_t concurrent_solves,
+                const std::atomic<bool> *interrupted) {
+  try {
+    Highs highs;
+    ApplyHighsOptions(highs, options);
+    // Hundreds of block solves would flood the log
+    highs.setOptionValue("output_flag", false);
+    if (highs.passModel(std::move(problem.lp)) != HighsStatus::kOk) {
+      throw std::runtime_error("Failed to pass model to HiGHS");
+    }
+    problem.lp = HighsLp();
+    HighsSolveSlot slot(settings, highs, options, concurrent_solves);
+    HighsRunMonitor monitor;
+    monitor.WatchInterrupt(interrupted);
+    monitor.Start(highs.getLp().num_col_, highs.getLp().num_row_,
+                  highs.getOptions().time_limit);
+    HighsMonitorScope scope(highs, monitor);
+    HighsStopwatch run;
+    if (highs.run() == HighsStatus::kError) {
+      throw std::runtime_error("Failed to solve model");
+    }
+    RecordRunProfile(highs, monitor, run.Seconds(), problem.profile);
+    problem.model_status = highs.getModelStatus();
+    problem.objective_value = highs.getInfo().objective_function_value;
+    problem.solution = highs.getSolution();
+  } catch (const std::exception &e) {
+    problem.error = e.what();
+  }
+}
+
+} // namespace
+
+std::vector<HighsBlock> FindModelBlocks(const HighsModelInfo &model_info,
+                                        idx_t min_block_size) {
+  idx_t num_col = model_info.next_var_index;
+  idx_t num_row = model_info.next_constraint_index;
+  auto &coefficients = model_info.constraint_coefficients;
+  // Every row joins its columns to the first one it was given
+  std::vector<int> first_col_of_row(num_row, -1);
+  ColumnUnion components(num_col);
+  coefficients.ForEach(0, coefficients.Size(), [&](int row, int col, double) {
+    if (first_col_of_row[row] < 0) {
+      first_col_of_row[row] = col;
+    } else {
+      components.Union(first_col_of_row[row], col);
+    }
+  });
+
+  // Number components by their first column, so blocks keep model order
+  std::vector<int> component_of_root(num_col, -1);
+  std::vector<int> component_of_col(num_col);
+  std::vector<idx_t> component_size;
+  for (idx_t col = 0; col < num_col; col++) {
+    int root = components.Find((int)col);
+    if (component_of_root[root] < 0) {
+      component_of_root[root] = (int)component_size.size();
+      component_size.push_back(0);
+    }
+    component_of_col[col] = component_of_root[root];
+    component_size[component_of_col[col]]++;
+  }
+  coefficients.ForEach(0, coefficients.Size(), [&](int, int col, double) {
+    component_size[component_of_col[col]]++;
+  });
+
+  // Pack consecutive small components into blocks of at least
+  // min_block_size
+  std::vector<int> block_of_component(component_size.size());
+  idx_t num_blocks = 0;
+  idx_t open_size = 0;
+  for (idx_t component = 0; component < component_size.size();
+       component++) {
+    if (num_blocks == 0 || open_size >= min_block_size) {
+      num_blocks++;
+      open_size = 0;
+    }
+    block_of_component[component] = (int)num_blocks - 1;
+    open_size += component_size[component];
+  }
+
+  std::vector<HighsBlock> blocks(MaxValue<idx_t>(num_blocks, 1));
+  for (idx_t col = 0; col < num_col; col++) {
+    blocks[block_of_component[component_of_col[col]]].columns.push_back(
+        (int)col);
+  }
+  for (idx_t row = 0; row < num_row; row++) {
+    int first_col = first_col_of_row[row];
+    int block = first_col < 0
+                    ? 0
+                    : block_of_component[component_of_col[first_col]];
+    blocks[block].rows.push_back((int)row);
+  }
+  return blocks;
+}
+
+std::shared_ptr<const HighsSolveResult>
+SolveModelDecomposed(HighsModelInfo &model_info,
+                     const HighsThreadSettings &settings,
+                     idx_t min_block_size,
+                     const std::atomic<bool> *interrupted,
+                     HighsBlockProgress *progress) {
+  auto result = std::make_shared<HighsSolveResult>();
+  std::vector<BlockProblem> problems;
+  HighsOptionProfile options;
+  double offset;
+  std::vector<double> row_lower;
+  std::vector<double> row_upper;
+  // Per-block passModel and presolve times overlap, so only the assembly
+  // and the parallel solve as a whole are timed
+  HighsSolveProfile profile;
+  profile.source = "decomposed";
+  profile.pass_model_time = std::numeric_limits<double>::quiet_NaN();
+  profile.presolve_time = std::numeric_limits<double>::quiet_NaN();
+  // Held for the block LPs, their HiGHS instances and the merged result
+  HighsMemoryCharge scratch;
+  HighsStopwatch assembly;
+  {
+    HighsSharedLock guard(model_info.mutex);
+    scratch.Attach(model_info.model_memory);
+    scratch.Resize(EstimateSolveBytes(
+        model_info.next_var_index, model_info.next_constraint_index,
+        model_info.constraint_coefficients.Size()));
+    result->model_version = model_info.mutex.Version();
+    result->columns.SnapshotColumns(model_info);
+    result->rows.SnapshotRows(model_info);
+    options = model_info.options;
+    offset = model_info.model.lp_.offset_;
+    row_lower = model_info.constraint_lower_bounds;
+    row_upper = model_info.constraint_upper_bounds;
+
+    // Blocks partition the columns and rows, so one local index per
+    // column and row, and one pass over the coefficients, serve them all
+    auto blocks = FindModelBlocks(model_info, min_block_size);
+    std::vector<int> local_index_of_col(model_info.next_var_index);
+    std::vector<int> local_index_of_row(model_info.next_constraint_index);
+    std::vector<int> block_of_row(model_info.next_constraint_index);
+    problems.resize(blocks.size());
+    for (idx_t b = 0; b < blocks.size(); b++) {
+      auto &columns = blocks[b].columns;
+      for (idx_t i = 0; i < columns.size(); i++) {
+        local_index_of_col[columns[i]] = (int)i;
+      }
+      auto &rows = blocks[b].rows;
+      for (idx_t i = 0; i < rows.size(); i++) {
+        local_index_of_row[rows[i]] = (int)i;
+        block_of_row[rows[i]] = (int)b;
+      }
+      problems[b].block = std::move(blocks[b]);
+    }
+    auto &coefficients = model_info.constraint_coefficients;
+    coefficients.ForEach(
+        0, coefficients.Size(), [&](int row, int col, double value) {
+          auto &problem = problems[block_of_row[row]];
+          problem.row_index.push_back(local_index_of_row[row]);
+          problem.col_index.push_back(local_index_of_col[col]);
+          problem.value.push_back(value);
+        });
+    for (auto &problem : problems) {
+      BuildBlockLp(model_info, problem);
+    }
+  }
+  profile.assembly_time = assembly.Seconds();
+  HighsStopwatch solve;
+
+  // Largest blocks first, so a big block does not start last and hold up
+  // the merge
+  std::vector<idx_t> order(problems.size());
+  for (idx_t b = 0; b < order.size(); b++) {
+    order[b] = b;
+  }
+  std::stable_sort(order.begin(), order.end(), [&](idx_t a, idx_t b) {
+    return problems[a].work > problems[b].work;
+  });
+
+  idx_t num_workers = MaxValue<idx_t>(
+      1, MinValue<idx_t>(settings.duckdb_threads, problems.size()));
+  HighsBlockProgress own_progress;
+  if (!progress) {
+    progress = &own_progress;
+  }
+  progress->next_block = 0;
+  progress->num_blocks = order.size();
+  auto worker = [&]() {
+    while (true) {
+      idx_t position = progress->next_block++;
+      if (position >= order.size()) {
+        return;
+      }
+      auto &problem = problems[order[position]];
+      if (interrupted && interrupted->load()) {
+        problem.model_status = HighsModelStatus::kInterrupt;
+        continue;
+      }
+      SolveBlock(problem, options, settings, num_workers, interrupted);
+    }
+  };
+  std::vector<std::thread> threads;
+  for (idx_t i = 1; i < num_workers; i++) {
+    threads.emplace_back(worker);
+  }
+  worker();
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  profile.solve_time = solve.Seconds();
+
+  // Merge the block solutions back into model order
+  idx_t num_col = result->columns.count;
+  idx_t num_row = result->rows.count;
+  result->col_value.assign(num_col, 0.0);
+  result->col_dual.assign(num_col, 0.0);
+  result->row_value.assign(num_row, 0.0);
+  result->row_dual.assign(num_row, 0.0);
+  result->model_status = HighsModelStatus::kOptimal;
+  result->objective_value = offset;
+  for (auto &problem : problems) {
+    if (!problem.error.empty()) {
+      throw std::runtime_error(problem.error);
+    }
+    if (StatusRank(problem.model_status) >
+        StatusRank(result->model_status)) {
+      result->model_status = problem.model_status;
+    }
+    result->objective_value += problem.objective_value;
+    auto &counters = problem.profile;
+    profile.simplex_iterations += counters.simplex_iterations;
+    profile.ipm_iterations += counters.ipm_iterations;
+    profile.crossover_iterations += counters.crossover_iterations;
+    profile.mip_nodes += counters.mip_nodes;
+    profile.presolve_removed_rows += counters.presolve_removed_rows;
+    profile.presolve_removed_columns += counters.presolve_removed_columns;
+    if (counters.mip) {
+      profile.mip_gap =
+          profile.mip ? MaxValue(profile.mip_gap, counters.mip_gap)
+                      : counters.mip_gap;
+      profile.mip = true;
+    }
+    auto &solution = problem.solution;
+    auto &columns = problem.block.columns;
+    auto &rows = problem.block.rows;
+    for (idx_t i = 0; i < columns.size(); i++) {
+      if (i < solution.col_value.size()) {
+        result->col_value[columns[i]] = solution.col_value[i];
+      }
+      if (i < solution.col_dual.size()) {
+        result->col_dual[columns[i]] = solution.col_dual[i];
+      }
+    }
+    for (idx_t i = 0; i < rows.size(); i++) {
+      if (i < solution.row_value.size()) {
+        result->row_value[rows[i]] = solution.row_value[i];
+      }
+      if (i < solution.row_dual.size()) {
+        result->row_dual[rows[i]] = solution.row_dual[i];
+      }
+    }
+  }
+
+  result->row_slack.assign(num_row, kHighsInf);
+  for (idx_t row = 0; row < MinValue<idx_t>(num_row, row_lower.size()); row++) {
+    double activity = result->row_value[row];
+    double &slack = result->row_slack[row];
+    if (row_upper[row] < kHighsInf) {
+      slack = MinValue(slack, row_upper[row] - activity);
+    }
+    if (row_lower[row] > -kHighsInf) {
+      slack = MinValue(slack, activity - row_lower[row]);
+    }
+  }
+  profile.model_status = result->model_status;
+  profile.objective_value = result->objective_value;
+  result->solve_id = model_info.solve_log.Record(std::move(profile));
+  return std::move(result);
+}
+
+} // namespace duckdb
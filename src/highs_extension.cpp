@@ -1,12 +1,29 @@
 #define DUCKDB_EXTENSION_MAIN
 
 #include "highs_extension.hpp"
+#include "highs_cache.hpp"
+#include "highs_decompose.hpp"
+#include "highs_jobs.hpp"
+#include "highs_matrix.hpp"
+#include "highs_memory.hpp"
+#include "highs_model.hpp"
+#include "highs_mps.hpp"
+#include "highs_names.hpp"
+#include "highs_output.hpp"
+#include "highs_profile.hpp"
+#include "highs_snapshot.hpp"
+#include "highs_threading.hpp"
 #include "duckdb.hpp"
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/file_system.hpp"
+#include "duckdb/main/config.hpp"
 #include "duckdb/main/extension_util.hpp"
 #include "duckdb/common/string_util.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/function/aggregate_function.hpp"
 #include "duckdb/function/scalar_function.hpp"
 #include "duckdb/function/table_function.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include <duckdb/parser/parsed_data/create_scalar_function_info.hpp>
 #include <duckdb/parser/parsed_data/create_table_function_info.hpp>
 
@@ -16,65 +33,24 @@
 // HiGHS headers
 #include "Highs.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cmath>
+#include <cstdlib>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <iterator>
+#include <limits>
+#include <map>
 #include <unordered_map>
 #include <mutex>
 #include <memory>
+#include <thread>
 
 namespace duckdb {
 
-// Model registry to store HiGHS models and their metadata
-struct HighsModelInfo {
-  HighsModel model;
-  std::unordered_map<std::string, int> variable_indices;
-  std::unordered_map<std::string, int> constraint_indices;
-  std::vector<std::string> variable_names;
-  std::vector<std::string> constraint_names;
-  std::vector<double> obj_coefficients;
-  std::vector<double> var_lower_bounds;
-  std::vector<double> var_upper_bounds;
-  std::vector<double> constraint_lower_bounds;
-  std::vector<double> constraint_upper_bounds;
-  std::vector<std::vector<std::pair<int, double>>>
-      constraint_coefficients;             // [constraint_idx][{var_idx, coeff}]
-  std::vector<std::string> variable_types; // 'continuous', 'integer', 'binary'
-  int next_var_index = 0;
-  int next_constraint_index = 0;
-
-  HighsModelInfo() { model.lp_.sense_ = ObjSense::kMinimize; }
-};
-
-class HighsModelRegistry {
-private:
-  std::unordered_map<std::string, std::unique_ptr<HighsModelInfo>> models;
-  std::mutex mutex_;
-
-public:
-  static HighsModelRegistry &Instance() {
-    static HighsModelRegistry instance;
-    return instance;
-  }
-
-  HighsModelInfo *GetOrCreateModel(const std::string &model_name) {
-    std::lock_guard<std::mutex> lock(mutex_);
-    auto it = models.find(model_name);
-    if (it == models.end()) {
-      models[model_name] = make_uniq<HighsModelInfo>();
-    }
-    return models[model_name].get();
-  }
-
-  HighsModelInfo *GetModel(const std::string &model_name) {
-    std::lock_guard<std::mutex> lock(mutex_);
-    auto it = models.find(model_name);
-    return (it != models.end()) ? it->second.get() : nullptr;
-  }
-
-  void RemoveModel(const std::string &model_name) {
-    std::lock_guard<std::mutex> lock(mutex_);
-    models.erase(model_name);
-  }
-};
-
 // Data structures for function bind data
 struct HighsCreateVariablesData : public TableFunctionData {
   std::string model_name;
@@ -101,14 +77,27 @@ struct HighsSetCoefficientsData : public TableFunctionData {
 
 struct HighsSolveData : public TableFunctionData {
   std::string model_name;
+  int64_t job_id = -1; // highs_job_solution: read a background job's result
+  bool decomposed = false; // highs_solve_decomposed: solve block by block
+  idx_t min_block_size = kDefaultMinBlockSize;
+  HighsSolveOutput output = HighsSolveOutput::VARIABLES;
 };
 
 struct HighsSolveGlobalState : public GlobalTableFunctionState {
-  bool solved = false;
-  std::vector<double> solution_values;
-  std::vector<double> reduced_costs;
-  HighsModelStatus model_status;
+  std::shared_ptr<const HighsSolveResult> result; // null until solved
+  HighsSolveOutput output = HighsSolveOutput::VARIABLES;
+  HighsSolveProjection projection;
   idx_t current_row = 0;
+  bool finished = false;
+  // Model the result was solved from, told the scan's emission time once
+  // it ends; null for job and table results
+  std::shared_ptr<HighsModelInfo> model_info;
+  double emission_time = 0.0;
+
+  // Read by the progress bar while the scan runs
+  HighsRunMonitor monitor;
+  HighsBlockProgress blocks; // of highs_solve_decomposed
+  std::atomic<double> emitted{-1}; // fraction of rows out, once solved
 };
 
 // Forward declaration
@@ -154,8 +143,71 @@ struct SingleRowGlobalState : public GlobalTableFunctionState {
   bool finished = false;
 };
 
+// Local state for table-in/out loaders: holds the input cast to the types
+// the loader expects
+struct HighsBulkLocalState : public LocalTableFunctionState {
+  DataChunk cast_chunk;
+};
+
+// Bind data for table-in/out loaders. Integer key columns switch a loader
+// to BIGINT ids, which map onto indices without any string hashing.
+struct HighsBulkBindData : public TableFunctionData {
+  bool id_keys = false;
+};
+
+// Key columns are either all integers or all names
+static bool UsesIdKeys(const vector<LogicalType> &types,
+                       std::initializer_list<idx_t> key_columns,
+                       const char *function_name) {
+  idx_t num_ids = 0;
+  for (idx_t col : key_columns) {
+    num_ids += types[col].IsIntegral() ? 1 : 0;
+  }
+  if (num_ids != 0 && num_ids != key_columns.size()) {
+    throw BinderException(std::string(function_name) +
+                          " expects either BIGINT ids or names in all key "
+                          "columns, not a mix");
+  }
+  return num_ids != 0;
+}
+
+// Key column type for a loader
+static LogicalType KeyType(bool id_keys) {
+  return id_keys ? LogicalType::BIGINT : LogicalType::VARCHAR;
+}
+
+static unique_ptr<LocalTableFunctionState>
+InitBulkLocalState(ExecutionContext &context, TableFunctionInitInput &input,
+                   const vector<LogicalType> &types) {
+  auto result = make_uniq<HighsBulkLocalState>();
+  result->cast_chunk.Initialize(Allocator::Get(context.client), types);
+  return std::move(result);
+}
+
+// Cast an input chunk to the loader's column types, referencing the columns
+// that already match
+static void CastInputChunk(ClientContext &context, DataChunk &input,
+                           DataChunk &cast_chunk) {
+  cast_chunk.Reset();
+  for (idx_t col = 0; col < cast_chunk.ColumnCount(); col++) {
+    if (input.data[col].GetType() == cast_chunk.data[col].GetType()) {
+      cast_chunk.data[col].Reference(input.data[col]);
+    } else {
+      VectorOperations::Cast(context, input.data[col], cast_chunk.data[col],
+                             input.size());
+    }
+  }
+  cast_chunk.SetCardinality(input.size());
+}
+
 // Table function for creating variables from a table
 struct HighsCreateVariablesFunction {
+  // Input columns of the table-in/out variant
+  static vector<LogicalType> BulkInputTypes(bool id_keys) {
+    return {LogicalType::VARCHAR, KeyType(id_keys),    LogicalType::DOUBLE,
+            LogicalType::DOUBLE,  LogicalType::DOUBLE, LogicalType::VARCHAR};
+  }
+
   static void CreateVariablesFunction(ClientContext &context,
                                       TableFunctionInput &data_p,
                                       DataChunk &output) {
@@ -169,26 +221,29 @@ struct HighsCreateVariablesFunction {
     }
 
     // Get model from registry
-    auto *model_info =
+    auto model_info =
         HighsModelRegistry::Instance().GetOrCreateModel(bind_data.model_name);
+    std::lock_guard<HighsModelLock> guard(model_info->mutex);
 
     try {
+      model_info->ClaimKeyType(HighsKeyType::NAME, bind_data.model_name);
       // Check if variable already exists
-      if (model_info->variable_indices.find(bind_data.variable_name) !=
-          model_info->variable_indices.end()) {
+      int var_index =
+          model_info->variable_names.Insert(bind_data.variable_name);
+      if (var_index < 0) {
         throw std::runtime_error("Variable '" + bind_data.variable_name +
                                  "' already exists in model '" +
                                  bind_data.model_name + "'");
       }
 
       // Store variable info
-      int var_index = model_info->next_var_index++;
-      model_info->variable_indices[bind_data.variable_name] = var_index;
-      model_info->variable_names.push_back(bind_data.variable_name);
+      model_info->next_var_index++;
       model_info->obj_coefficients.push_back(bind_data.obj_coefficient);
       model_info->var_lower_bounds.push_back(bind_data.lower_bound);
       model_info->var_upper_bounds.push_back(bind_data.upper_bound);
-      model_info->variable_types.push_back(bind_data.var_type);
+      model_info->variable_types.push_back(
+          ParseVariableType(bind_data.var_type));
+      model_info->FingerprintVariable(var_index, 1);
 
       // Update model dimensions
       model_info->model.lp_.num_col_ = model_info->next_var_index;
@@ -223,6 +278,9 @@ struct HighsCreateVariablesFunction {
           output.data[2], "ERROR: " + std::string(e.what()));
     }
 
+    // Outside the try: running out of memory fails the query
+    ChargeModelMemory(context, *model_info);
+
     global_state.finished = true;
   }
 
@@ -261,6 +319,189 @@ struct HighsCreateVariablesFunction {
   CreateVariablesInit(ClientContext &context, TableFunctionInitInput &input) {
     return make_uniq<SingleRowGlobalState>();
   }
+
+  // Table-in/out variant: highs_create_variables((SELECT model_name,
+  // variable_name, lower_bound, upper_bound, obj_coefficient, var_type ...)).
+  // Emits one row per input row with the same schema as the scalar variant.
+  // NULL bounds default to [0, inf), a NULL cost to 0 and a NULL type to
+  // 'continuous'. An integer variable column loads the model by BIGINT id
+  // instead; the output is then (variable_id, status).
+  static OperatorResultType
+  CreateVariablesBulkFunction(ExecutionContext &context,
+                              TableFunctionInput &data_p, DataChunk &input,
+                              DataChunk &output) {
+    bool id_keys = data_p.bind_data->Cast<HighsBulkBindData>().id_keys;
+    auto &local_state = data_p.local_state->Cast<HighsBulkLocalState>();
+    auto &chunk = local_state.cast_chunk;
+    CastInputChunk(context.client, input, chunk);
+    idx_t count = chunk.size();
+
+    UnifiedVectorFormat formats[6];
+    for (idx_t col = 0; col < 6; col++) {
+      chunk.data[col].ToUnifiedFormat(count, formats[col]);
+    }
+    auto model_names = UnifiedVectorFormat::GetData<string_t>(formats[0]);
+    // Only one of these views of the key column is used, by key type
+    auto variable_ids = UnifiedVectorFormat::GetData<int64_t>(formats[1]);
+    auto variable_names = UnifiedVectorFormat::GetData<string_t>(formats[1]);
+    auto lower_bounds = UnifiedVectorFormat::GetData<double>(formats[2]);
+    auto upper_bounds = UnifiedVectorFormat::GetData<double>(formats[3]);
+    auto obj_coefficients = UnifiedVectorFormat::GetData<double>(formats[4]);
+    auto var_types = UnifiedVectorFormat::GetData<string_t>(formats[5]);
+
+    output.SetCardinality(count);
+    output.data[0].Reference(chunk.data[1]);
+    idx_t status_col = id_keys ? 1 : 2;
+    auto status_vector = FlatVector::GetData<string_t>(output.data[status_col]);
+
+    auto set_error = [&](idx_t row, const std::string &message) {
+      if (!id_keys) {
+        FlatVector::GetData<string_t>(output.data[1])[row] = string_t("ERROR");
+      }
+      status_vector[row] = StringVector::AddString(output.data[status_col],
+                                                   "ERROR: " + message);
+    };
+
+    // Rows arrive grouped by model in practice, so handle each run of equal
+    // model names under a single lock with space reserved up front
+    idx_t run_start = 0;
+    while (run_start < count) {
+      auto model_idx = formats[0].sel->get_index(run_start);
+      if (!formats[0].validity.RowIsValid(model_idx)) {
+        set_error(run_start, "model_name must not be NULL");
+        run_start++;
+        continue;
+      }
+      string_t model_name = model_names[model_idx];
+      idx_t run_end = run_start + 1;
+      while (run_end < count) {
+        auto idx = formats[0].sel->get_index(run_end);
+        if (!formats[0].validity.RowIsValid(idx) ||
+            !(model_names[idx] == model_name)) {
+          break;
+        }
+        run_end++;
+      }
+
+      std::string model_name_str = model_name.GetString();
+      auto model_info =
+          HighsModelRegistry::Instance().GetOrCreateModel(model_name_str);
+      std::lock_guard<HighsModelLock> guard(model_info->mutex);
+      try {
+        model_info->ClaimKeyType(
+            id_keys ? HighsKeyType::ID : HighsKeyType::NAME, model_name_str);
+      } catch (const std::exception &e) {
+        for (idx_t row = run_start; row < run_end; row++) {
+          set_error(row, e.what());
+        }
+        run_start = run_end;
+        continue;
+      }
+
+      ReserveModelVariables(context.client, *model_info,
+                            model_info->next_var_index +
+                                (run_end - run_start));
+
+      for (idx_t row = run_start; row < run_end; row++) {
+        auto key_idx = formats[1].sel->get_index(row);
+        if (!formats[1].validity.RowIsValid(key_idx)) {
+          set_error(row, id_keys ? "variable_id must not be NULL"
+                                 : "variable_name must not be NULL");
+          continue;
+        }
+
+        // A single probe both detects duplicates (in the model or earlier in
+        // this batch) and claims the index
+        int var_index;
+        if (id_keys) {
+          int64_t id = variable_ids[key_idx];
+          var_index = model_info->variable_ids.Insert(id);
+          if (var_index < 0) {
+            set_error(row, "Variable " + std::to_string(id) +
+                               " already exists in model '" + model_name_str +
+                               "'");
+            continue;
+          }
+        } else {
+          const string_t &variable_name = variable_names[key_idx];
+          var_index = model_info->variable_names.Insert(variable_name);
+          if (var_index < 0) {
+            set_error(row, "Variable '" + variable_name.GetString() +
+                               "' already exists in model '" +
+                               model_name_str + "'");
+            continue;
+          }
+          FlatVector::GetData<string_t>(output.data[1])[row] =
+              FormatIndexedName(output.data[1], variable_name, var_index);
+        }
+        model_info->next_var_index++;
+
+        auto lower_idx = formats[2].sel->get_index(row);
+        auto upper_idx = formats[3].sel->get_index(row);
+        auto cost_idx = formats[4].sel->get_index(row);
+        auto type_idx = formats[5].sel->get_index(row);
+        model_info->obj_coefficients.push_back(
+            formats[4].validity.RowIsValid(cost_idx)
+                ? obj_coefficients[cost_idx]
+                : 0.0);
+        model_info->var_lower_bounds.push_back(
+            formats[2].validity.RowIsValid(lower_idx)
+                ? lower_bounds[lower_idx]
+                : 0.0);
+        model_info->var_upper_bounds.push_back(
+            formats[3].validity.RowIsValid(upper_idx)
+                ? upper_bounds[upper_idx]
+                : kHighsInf);
+        model_info->variable_types.push_back(
+            formats[5].validity.RowIsValid(type_idx)
+                ? ParseVariableType(var_types[type_idx])
+                : HighsVariableType::CONTINUOUS);
+        model_info->FingerprintVariable(model_info->next_var_index - 1, 1);
+        status_vector[row] = string_t("SUCCESS");
+      }
+      model_info->model.lp_.num_col_ = model_info->next_var_index;
+      run_start = run_end;
+    }
+    return OperatorResultType::NEED_MORE_INPUT;
+  }
+
+  static unique_ptr<FunctionData>
+  CreateVariablesBulkBind(ClientContext &context, TableFunctionBindInput &input,
+                          vector<LogicalType> &return_types,
+                          vector<string> &names) {
+    if (input.input_table_types.size() != 6) {
+      throw BinderException(
+          "highs_create_variables expects a table with exactly 6 columns: "
+          "model_name, variable_name, lower_bound, upper_bound, "
+          "obj_coefficient, var_type");
+    }
+    auto result = make_uniq<HighsBulkBindData>();
+    result->id_keys =
+        UsesIdKeys(input.input_table_types, {1}, "highs_create_variables");
+
+    // Define output schema
+    if (result->id_keys) {
+      names.emplace_back("variable_id");
+      return_types.emplace_back(LogicalType::BIGINT);
+    } else {
+      names.emplace_back("variable_name");
+      return_types.emplace_back(LogicalType::VARCHAR);
+      names.emplace_back("variable_index");
+      return_types.emplace_back(LogicalType::VARCHAR);
+    }
+    names.emplace_back("status");
+    return_types.emplace_back(LogicalType::VARCHAR);
+
+    return std::move(result);
+  }
+
+  static unique_ptr<LocalTableFunctionState>
+  CreateVariablesBulkInitLocal(ExecutionContext &context,
+                               TableFunctionInitInput &input,
+                               GlobalTableFunctionState *global_state) {
+    bool id_keys = input.bind_data->Cast<HighsBulkBindData>().id_keys;
+    return InitBulkLocalState(context, input, BulkInputTypes(id_keys));
+  }
 };
 
 // Table function for creating constraints from a table
@@ -278,27 +519,26 @@ struct HighsCreateConstraintsFunction {
     }
 
     // Get model from registry
-    auto *model_info =
+    auto model_info =
         HighsModelRegistry::Instance().GetOrCreateModel(bind_data.model_name);
+    std::lock_guard<HighsModelLock> guard(model_info->mutex);
 
     try {
+      model_info->ClaimKeyType(HighsKeyType::NAME, bind_data.model_name);
       // Check if constraint already exists
-      if (model_info->constraint_indices.find(bind_data.constraint_name) !=
-          model_info->constraint_indices.end()) {
+      int constraint_index =
+          model_info->constraint_names.Insert(bind_data.constraint_name);
+      if (constraint_index < 0) {
         throw std::runtime_error("Constraint '" + bind_data.constraint_name +
                                  "' already exists in model '" +
                                  bind_data.model_name + "'");
       }
 
       // Store constraint info
-      int constraint_index = model_info->next_constraint_index++;
-      model_info->constraint_indices[bind_data.constraint_name] =
-          constraint_index;
-      model_info->constraint_names.push_back(bind_data.constraint_name);
+      model_info->next_constraint_index++;
       model_info->constraint_lower_bounds.push_back(bind_data.lower_bound);
       model_info->constraint_upper_bounds.push_back(bind_data.upper_bound);
-      model_info->constraint_coefficients.push_back(
-          std::vector<std::pair<int, double>>());
+      model_info->FingerprintConstraint(constraint_index, 1);
 
       // Update model dimensions
       model_info->model.lp_.num_row_ = model_info->next_constraint_index;
@@ -335,6 +575,8 @@ struct HighsCreateConstraintsFunction {
           output.data[2], "ERROR: " + std::string(e.what()));
     }
 
+    ChargeModelMemory(context, *model_info);
+
     global_state.finished = true;
   }
 
@@ -371,6 +613,180 @@ struct HighsCreateConstraintsFunction {
   CreateConstraintsInit(ClientContext &context, TableFunctionInitInput &input) {
     return make_uniq<SingleRowGlobalState>();
   }
+
+  // Input columns of the table-in/out variant
+  static vector<LogicalType> BulkInputTypes(bool id_keys) {
+    return {LogicalType::VARCHAR, KeyType(id_keys), LogicalType::DOUBLE,
+            LogicalType::DOUBLE};
+  }
+
+  // Table-in/out variant: highs_create_constraints((SELECT model_name,
+  // constraint_name, lower_bound, upper_bound ...)). Works like the
+  // highs_create_variables table variant, including BIGINT ids for an
+  // integer constraint column. NULL bounds default to (-inf, inf).
+  static OperatorResultType
+  CreateConstraintsBulkFunction(ExecutionContext &context,
+                                TableFunctionInput &data_p, DataChunk &input,
+                                DataChunk &output) {
+    bool id_keys = data_p.bind_data->Cast<HighsBulkBindData>().id_keys;
+    auto &local_state = data_p.local_state->Cast<HighsBulkLocalState>();
+    auto &chunk = local_state.cast_chunk;
+    CastInputChunk(context.client, input, chunk);
+    idx_t count = chunk.size();
+
+    UnifiedVectorFormat formats[4];
+    for (idx_t col = 0; col < 4; col++) {
+      chunk.data[col].ToUnifiedFormat(count, formats[col]);
+    }
+    auto model_names = UnifiedVectorFormat::GetData<string_t>(formats[0]);
+    // Only one of these views of the key column is used, by key type
+    auto constraint_ids = UnifiedVectorFormat::GetData<int64_t>(formats[1]);
+    auto constraint_names = UnifiedVectorFormat::GetData<string_t>(formats[1]);
+    auto lower_bounds = UnifiedVectorFormat::GetData<double>(formats[2]);
+    auto upper_bounds = UnifiedVectorFormat::GetData<double>(formats[3]);
+
+    output.SetCardinality(count);
+    output.data[0].Reference(chunk.data[1]);
+    idx_t status_col = id_keys ? 1 : 2;
+    auto status_vector = FlatVector::GetData<string_t>(output.data[status_col]);
+
+    auto set_error = [&](idx_t row, const std::string &message) {
+      if (!id_keys) {
+        FlatVector::GetData<string_t>(output.data[1])[row] = string_t("ERROR");
+      }
+      status_vector[row] = StringVector::AddString(output.data[status_col],
+                                                   "ERROR: " + message);
+    };
+
+    idx_t run_start = 0;
+    while (run_start < count) {
+      auto model_idx = formats[0].sel->get_index(run_start);
+      if (!formats[0].validity.RowIsValid(model_idx)) {
+        set_error(run_start, "model_name must not be NULL");
+        run_start++;
+        continue;
+      }
+      string_t model_name = model_names[model_idx];
+      idx_t run_end = run_start + 1;
+      while (run_end < count) {
+        auto idx = formats[0].sel->get_index(run_end);
+        if (!formats[0].validity.RowIsValid(idx) ||
+            !(model_names[idx] == model_name)) {
+          break;
+        }
+        run_end++;
+      }
+
+      std::string model_name_str = model_name.GetString();
+      auto model_info =
+          HighsModelRegistry::Instance().GetOrCreateModel(model_name_str);
+      std::lock_guard<HighsModelLock> guard(model_info->mutex);
+      try {
+        model_info->ClaimKeyType(
+            id_keys ? HighsKeyType::ID : HighsKeyType::NAME, model_name_str);
+      } catch (const std::exception &e) {
+        for (idx_t row = run_start; row < run_end; row++) {
+          set_error(row, e.what());
+        }
+        run_start = run_end;
+        continue;
+      }
+
+      ReserveModelConstraints(context.client, *model_info,
+                              model_info->next_constraint_index +
+                                  (run_end - run_start));
+
+      for (idx_t row = run_start; row < run_end; row++) {
+        auto key_idx = formats[1].sel->get_index(row);
+        if (!formats[1].validity.RowIsValid(key_idx)) {
+          set_error(row, id_keys ? "constraint_id must not be NULL"
+                                 : "constraint_name must not be NULL");
+          continue;
+        }
+
+        int constraint_index;
+        if (id_keys) {
+          int64_t id = constraint_ids[key_idx];
+          constraint_index = model_info->constraint_ids.Insert(id);
+          if (constraint_index < 0) {
+            set_error(row, "Constraint " + std::to_string(id) +
+                               " already exists in model '" + model_name_str +
+                               "'");
+            continue;
+          }
+        } else {
+          const string_t &constraint_name = constraint_names[key_idx];
+          constraint_index =
+              model_info->constraint_names.Insert(constraint_name);
+          if (constraint_index < 0) {
+            set_error(row, "Constraint '" + constraint_name.GetString() +
+                               "' already exists in model '" +
+                               model_name_str + "'");
+            continue;
+          }
+          FlatVector::GetData<string_t>(output.data[1])[row] =
+              FormatIndexedName(output.data[1], constraint_name,
+                                constraint_index);
+        }
+        model_info->next_constraint_index++;
+
+        auto lower_idx = formats[2].sel->get_index(row);
+        auto upper_idx = formats[3].sel->get_index(row);
+        model_info->constraint_lower_bounds.push_back(
+            formats[2].validity.RowIsValid(lower_idx)
+                ? lower_bounds[lower_idx]
+                : -kHighsInf);
+        model_info->constraint_upper_bounds.push_back(
+            formats[3].validity.RowIsValid(upper_idx)
+                ? upper_bounds[upper_idx]
+                : kHighsInf);
+        model_info->FingerprintConstraint(
+            model_info->next_constraint_index - 1, 1);
+        status_vector[row] = string_t("SUCCESS");
+      }
+      model_info->model.lp_.num_row_ = model_info->next_constraint_index;
+      run_start = run_end;
+    }
+    return OperatorResultType::NEED_MORE_INPUT;
+  }
+
+  static unique_ptr<FunctionData>
+  CreateConstraintsBulkBind(ClientContext &context,
+                            TableFunctionBindInput &input,
+                            vector<LogicalType> &return_types,
+                            vector<string> &names) {
+    if (input.input_table_types.size() != 4) {
+      throw BinderException(
+          "highs_create_constraints expects a table with exactly 4 columns: "
+          "model_name, constraint_name, lower_bound, upper_bound");
+    }
+    auto result = make_uniq<HighsBulkBindData>();
+    result->id_keys =
+        UsesIdKeys(input.input_table_types, {1}, "highs_create_constraints");
+
+    // Define output schema
+    if (result->id_keys) {
+      names.emplace_back("constraint_id");
+      return_types.emplace_back(LogicalType::BIGINT);
+    } else {
+      names.emplace_back("constraint_name");
+      return_types.emplace_back(LogicalType::VARCHAR);
+      names.emplace_back("constraint_index");
+      return_types.emplace_back(LogicalType::VARCHAR);
+    }
+    names.emplace_back("status");
+    return_types.emplace_back(LogicalType::VARCHAR);
+
+    return std::move(result);
+  }
+
+  static unique_ptr<LocalTableFunctionState>
+  CreateConstraintsBulkInitLocal(ExecutionContext &context,
+                                 TableFunctionInitInput &input,
+                                 GlobalTableFunctionState *global_state) {
+    bool id_keys = input.bind_data->Cast<HighsBulkBindData>().id_keys;
+    return InitBulkLocalState(context, input, BulkInputTypes(id_keys));
+  }
 };
 
 // Table function for setting coefficients from a table
@@ -388,7 +804,7 @@ struct HighsSetCoefficientsFunction {
     }
 
     // Get model from registry
-    auto *model_info =
+    auto model_info =
         HighsModelRegistry::Instance().GetModel(bind_data.model_name);
     if (!model_info) {
       output.SetCardinality(1);
@@ -410,30 +826,31 @@ struct HighsSetCoefficientsFunction {
       return;
     }
 
+    std::lock_guard<HighsModelLock> guard(model_info->mutex);
     try {
+      model_info->ClaimKeyType(HighsKeyType::NAME, bind_data.model_name);
       // Find variable and constraint indices
-      auto var_it = model_info->variable_indices.find(bind_data.variable_name);
-      auto constraint_it =
-          model_info->constraint_indices.find(bind_data.constraint_name);
+      int var_index = model_info->variable_names.Find(bind_data.variable_name);
+      int constraint_index =
+          model_info->constraint_names.Find(bind_data.constraint_name);
 
-      if (var_it == model_info->variable_indices.end()) {
+      if (var_index < 0) {
         throw std::runtime_error("Variable '" + bind_data.variable_name +
                                  "' not found in model '" +
                                  bind_data.model_name + "'");
       }
 
-      if (constraint_it == model_info->constraint_indices.end()) {
+      if (constraint_index < 0) {
         throw std::runtime_error("Constraint '" + bind_data.constraint_name +
                                  "' not found in model '" +
                                  bind_data.model_name + "'");
       }
 
-      int var_index = var_it->second;
-      int constraint_index = constraint_it->second;
-
       // Store the coefficient for later matrix construction
-      model_info->constraint_coefficients[constraint_index].push_back(
-          {var_index, bind_data.coefficient});
+      model_info->constraint_coefficients.Append(
+          constraint_index, var_index, bind_data.coefficient);
+      model_info->FingerprintCoefficient(constraint_index, var_index,
+                                         bind_data.coefficient);
 
       // Set output
       output.SetCardinality(1);
@@ -467,6 +884,8 @@ struct HighsSetCoefficientsFunction {
           output.data[3], "ERROR: " + std::string(e.what()));
     }
 
+    ChargeModelMemory(context, *model_info);
+
     global_state.finished = true;
   }
 
@@ -505,259 +924,3446 @@ struct HighsSetCoefficientsFunction {
   SetCoefficientsInit(ClientContext &context, TableFunctionInitInput &input) {
     return make_uniq<SingleRowGlobalState>();
   }
-};
 
-// Table function for solving model and returning results
-struct HighsSolveFunction {
-  static void SolveFunction(ClientContext &context, TableFunctionInput &data_p,
-                            DataChunk &output) {
-    auto &bind_data = data_p.bind_data->Cast<HighsSolveData>();
-    auto &global_state = data_p.global_state->Cast<HighsSolveGlobalState>();
+  // Input columns of the table-in/out variant
+  static vector<LogicalType> BulkInputTypes(bool id_keys) {
+    return {LogicalType::VARCHAR, KeyType(id_keys), KeyType(id_keys),
+            LogicalType::DOUBLE};
+  }
 
-    // Get model from registry
-    auto *model_info =
-        HighsModelRegistry::Instance().GetModel(bind_data.model_name);
-    if (!model_info) {
-      output.SetCardinality(1);
-      auto variable_name_vector = FlatVector::GetData<string_t>(output.data[0]);
-      auto variable_index_vector =
-          FlatVector::GetData<string_t>(output.data[1]);
-      auto solution_value_vector = FlatVector::GetData<double>(output.data[2]);
-      auto reduced_cost_vector = FlatVector::GetData<double>(output.data[3]);
-      auto status_vector = FlatVector::GetData<string_t>(output.data[4]);
+  // Triplets resolved by one pipeline thread for one model
+  struct CoefficientBuffer {
+    std::string model_name;
+    // Holds the rows with a NULL model_name, which are all rejected
+    bool null_model = false;
+    std::shared_ptr<HighsModelInfo> model_info;
+    std::vector<int> rows;
+    std::vector<int> cols;
+    std::vector<double> values;
+    idx_t rejected = 0;
+    std::string first_error;
+    // What the triplet vectors hold, charged to the buffer pool
+    HighsMemoryCharge charge;
 
-      variable_name_vector[0] = StringVector::AddString(output.data[0], "N/A");
-      variable_index_vector[0] =
-          StringVector::AddString(output.data[1], "ERROR");
-      solution_value_vector[0] = 0.0;
-      reduced_cost_vector[0] = 0.0;
-      status_vector[0] = StringVector::AddString(
-          output.data[4],
-          "ERROR: Model '" + bind_data.model_name + "' not found");
-      return;
+    // Append a triplet; growth of the vectors is charged before it is
+    // allocated
+    void Add(int row, int col, double value) {
+      if (rows.size() == rows.capacity()) {
+        idx_t capacity = GrownCapacity(
+            rows.capacity(),
+            MaxValue<idx_t>(rows.size() + 1, STANDARD_VECTOR_SIZE));
+        charge.Resize(capacity * (2 * sizeof(int) + sizeof(double)));
+        rows.reserve(capacity);
+        cols.reserve(capacity);
+        values.reserve(capacity);
+      }
+      rows.push_back(row);
+      cols.push_back(col);
+      values.push_back(value);
     }
+  };
 
-    // Solve the model if not already solved
-    if (!global_state.solved) {
-      try {
-        // Build the complete model
-        model_info->model.lp_.col_cost_ = model_info->obj_coefficients;
-        model_info->model.lp_.col_lower_ = model_info->var_lower_bounds;
-        model_info->model.lp_.col_upper_ = model_info->var_upper_bounds;
-        model_info->model.lp_.row_lower_ = model_info->constraint_lower_bounds;
-        model_info->model.lp_.row_upper_ = model_info->constraint_upper_bounds;
-
-        // Build constraint matrix in column-wise format
-        std::vector<HighsInt> start;
-        std::vector<HighsInt> index;
-        std::vector<double> value;
-
-        start.push_back(0);
-        for (int col = 0; col < model_info->next_var_index; col++) {
-          for (int row = 0; row < model_info->next_constraint_index; row++) {
-            for (const auto &coeff : model_info->constraint_coefficients[row]) {
-              if (coeff.first == col) {
-                index.push_back(row);
-                value.push_back(coeff.second);
-              }
-            }
-          }
-          start.push_back(index.size());
-        }
+  struct BulkLocalState : public HighsBulkLocalState {
+    std::vector<CoefficientBuffer> buffers;
+    idx_t emitted = 0;
 
-        model_info->model.lp_.a_matrix_.format_ = MatrixFormat::kColwise;
-        model_info->model.lp_.a_matrix_.start_ = start;
-        model_info->model.lp_.a_matrix_.index_ = index;
-        model_info->model.lp_.a_matrix_.value_ = value;
-
-        // Configure integer/binary variables
-        std::vector<HighsVarType> var_types;
-        for (int i = 0; i < model_info->next_var_index; i++) {
-          const std::string &var_type = model_info->variable_types[i];
-          if (var_type == "binary") {
-            var_types.push_back(HighsVarType::kInteger);
-            // For binary variables, ensure bounds are [0,1]
-            model_info->model.lp_.col_lower_[i] =
-                std::max(0.0, model_info->model.lp_.col_lower_[i]);
-            model_info->model.lp_.col_upper_[i] =
-                std::min(1.0, model_info->model.lp_.col_upper_[i]);
-          } else if (var_type == "integer") {
-            var_types.push_back(HighsVarType::kInteger);
-          } else {
-            var_types.push_back(HighsVarType::kContinuous);
-          }
+    CoefficientBuffer &GetBuffer(ClientContext &context,
+                                 const string_t &model_name) {
+      // Rows usually arrive grouped by model, so the most recently used
+      // buffer is kept at the back
+      for (idx_t i = buffers.size(); i > 0; i--) {
+        auto &buffer = buffers[i - 1];
+        if (!buffer.null_model &&
+            buffer.model_name.compare(0, std::string::npos,
+                                      model_name.GetData(),
+                                      model_name.GetSize()) == 0) {
+          std::swap(buffer, buffers.back());
+          return buffers.back();
         }
-        model_info->model.lp_.integrality_ = var_types;
+      }
+      CoefficientBuffer buffer;
+      buffer.model_name = model_name.GetString();
+      buffer.model_info =
+          HighsModelRegistry::Instance().GetModel(buffer.model_name);
+      buffer.charge.Attach(context);
+      buffers.push_back(std::move(buffer));
+      return buffers.back();
+    }
 
-        // Solve the model
-        Highs highs;
-        HighsStatus status = highs.passModel(model_info->model);
-        if (status != HighsStatus::kOk) {
-          throw std::runtime_error("Failed to pass model to HiGHS");
+    CoefficientBuffer &GetNullModelBuffer() {
+      for (auto &buffer : buffers) {
+        if (buffer.null_model) {
+          return buffer;
         }
+      }
+      CoefficientBuffer buffer;
+      buffer.null_model = true;
+      buffers.push_back(std::move(buffer));
+      return buffers.back();
+    }
+  };
 
-        status = highs.run();
-        if (status != HighsStatus::kOk) {
-          throw std::runtime_error("Failed to solve model");
-        }
+  static void Reject(CoefficientBuffer &buffer, const std::string &message) {
+    if (buffer.rejected++ == 0) {
+      buffer.first_error = message;
+    }
+  }
 
-        // Get solution
-        const HighsSolution &solution = highs.getSolution();
-        global_state.solution_values = solution.col_value;
-        global_state.reduced_costs = solution.col_dual;
-        global_state.model_status = highs.getModelStatus();
-        global_state.solved = true;
+  // Table-in/out variant: highs_set_coefficients((SELECT model_name,
+  // constraint_name, variable_name, coefficient ...)). Every pipeline thread
+  // resolves names into its own triplet buffers; the buffers are merged into
+  // the model once, when the thread finishes. Emits one summary row per
+  // model and thread; rows with a NULL model_name are counted as rejected
+  // in a summary row whose model_name is NULL. Integer constraint and
+  // variable columns are resolved as BIGINT ids, for models loaded by id.
+  static OperatorResultType
+  SetCoefficientsBulkFunction(ExecutionContext &context,
+                              TableFunctionInput &data_p, DataChunk &input,
+                              DataChunk &output) {
+    bool id_keys = data_p.bind_data->Cast<HighsBulkBindData>().id_keys;
+    auto key_type = id_keys ? HighsKeyType::ID : HighsKeyType::NAME;
+    auto &local_state = data_p.local_state->Cast<BulkLocalState>();
+    auto &chunk = local_state.cast_chunk;
+    CastInputChunk(context.client, input, chunk);
+    idx_t count = chunk.size();
 
-      } catch (const std::exception &e) {
-        output.SetCardinality(1);
-        auto variable_name_vector =
-            FlatVector::GetData<string_t>(output.data[0]);
-        auto variable_index_vector =
-            FlatVector::GetData<string_t>(output.data[1]);
-        auto solution_value_vector =
-            FlatVector::GetData<double>(output.data[2]);
-        auto reduced_cost_vector = FlatVector::GetData<double>(output.data[3]);
-        auto status_vector = FlatVector::GetData<string_t>(output.data[4]);
-
-        variable_name_vector[0] =
-            StringVector::AddString(output.data[0], "N/A");
-        variable_index_vector[0] =
-            StringVector::AddString(output.data[1], "ERROR");
-        solution_value_vector[0] = 0.0;
-        reduced_cost_vector[0] = 0.0;
-        status_vector[0] = StringVector::AddString(
-            output.data[4], "ERROR: " + std::string(e.what()));
-        return;
-      }
+    UnifiedVectorFormat formats[4];
+    for (idx_t col = 0; col < 4; col++) {
+      chunk.data[col].ToUnifiedFormat(count, formats[col]);
     }
+    auto model_names = UnifiedVectorFormat::GetData<string_t>(formats[0]);
+    // Only one of these views of each key column is used, by key type
+    auto constraint_ids = UnifiedVectorFormat::GetData<int64_t>(formats[1]);
+    auto constraint_names = UnifiedVectorFormat::GetData<string_t>(formats[1]);
+    auto variable_ids = UnifiedVectorFormat::GetData<int64_t>(formats[2]);
+    auto variable_names = UnifiedVectorFormat::GetData<string_t>(formats[2]);
+    auto coefficients = UnifiedVectorFormat::GetData<double>(formats[3]);
 
-    // Output solution rows
-    idx_t num_variables = model_info->variable_names.size();
-    idx_t current_row = global_state.current_row;
+    // Name lookups read the model's indices, so hold its lock shared while
+    // consecutive rows target the same model. Only one model lock is held
+    // at a time.
+    HighsModelInfo *read_model = nullptr;
+    HighsSharedLock read_guard;
+    for (idx_t row = 0; row < count; row++) {
+      auto model_idx = formats[0].sel->get_index(row);
+      if (!formats[0].validity.RowIsValid(model_idx)) {
+        // Reported in a summary row of their own
+        Reject(local_state.GetNullModelBuffer(),
+               "model_name must not be NULL");
+        continue;
+      }
+      auto &buffer =
+          local_state.GetBuffer(context.client, model_names[model_idx]);
+      if (!buffer.model_info) {
+        Reject(buffer, "Model '" + buffer.model_name + "' not found");
+        continue;
+      }
+      if (buffer.model_info.get() != read_model) {
+        read_guard.Lock(buffer.model_info->mutex);
+        read_model = buffer.model_info.get();
+      }
+      auto &model_info = *buffer.model_info;
+      if (model_info.key_type != key_type &&
+          model_info.key_type != HighsKeyType::UNSET) {
+        Reject(buffer, "Model '" + buffer.model_name + "' is keyed by " +
+                           (id_keys ? "names" : "BIGINT ids"));
+        continue;
+      }
 
-    // Check if we've output all variables
-    if (current_row >= num_variables) {
-      output.SetCardinality(0);
-      return;
-    }
+      auto constraint_idx = formats[1].sel->get_index(row);
+      auto variable_idx = formats[2].sel->get_index(row);
+      auto coefficient_idx = formats[3].sel->get_index(row);
+      if (!formats[1].validity.RowIsValid(constraint_idx) ||
+          !formats[2].validity.RowIsValid(variable_idx) ||
+          !formats[3].validity.RowIsValid(coefficient_idx)) {
+        Reject(buffer, "NULL constraint_name, variable_name or coefficient");
+        continue;
+      }
 
-    idx_t batch_size =
-        std::min(num_variables - current_row, (idx_t)STANDARD_VECTOR_SIZE);
-    output.SetCardinality(batch_size);
-    auto variable_name_vector = FlatVector::GetData<string_t>(output.data[0]);
-    auto variable_index_vector = FlatVector::GetData<string_t>(output.data[1]);
-    auto solution_value_vector = FlatVector::GetData<double>(output.data[2]);
-    auto reduced_cost_vector = FlatVector::GetData<double>(output.data[3]);
-    auto status_vector = FlatVector::GetData<string_t>(output.data[4]);
-
-    std::string status_str;
-    switch (global_state.model_status) {
-    case HighsModelStatus::kOptimal:
-      status_str = "Optimal";
-      break;
-    case HighsModelStatus::kInfeasible:
-      status_str = "Infeasible";
-      break;
-    case HighsModelStatus::kUnbounded:
-      status_str = "Unbounded";
-      break;
-    default:
-      status_str = "Unknown";
-      break;
+      int var_index;
+      int constraint_index;
+      if (id_keys) {
+        var_index = model_info.variable_ids.Find(variable_ids[variable_idx]);
+        if (var_index < 0) {
+          Reject(buffer, "Variable " +
+                             std::to_string(variable_ids[variable_idx]) +
+                             " not found in model '" + buffer.model_name +
+                             "'");
+          continue;
+        }
+        constraint_index =
+            model_info.constraint_ids.Find(constraint_ids[constraint_idx]);
+        if (constraint_index < 0) {
+          Reject(buffer, "Constraint " +
+                             std::to_string(constraint_ids[constraint_idx]) +
+                             " not found in model '" + buffer.model_name +
+                             "'");
+          continue;
+        }
+      } else {
+        const string_t &variable_name = variable_names[variable_idx];
+        var_index = model_info.variable_names.Find(variable_name);
+        if (var_index < 0) {
+          Reject(buffer, "Variable '" + variable_name.GetString() +
+                             "' not found in model '" + buffer.model_name +
+                             "'");
+          continue;
+        }
+        const string_t &constraint_name = constraint_names[constraint_idx];
+        constraint_index = model_info.constraint_names.Find(constraint_name);
+        if (constraint_index < 0) {
+          Reject(buffer, "Constraint '" + constraint_name.GetString() +
+                             "' not found in model '" + buffer.model_name +
+                             "'");
+          continue;
+        }
+      }
+
+      buffer.Add(constraint_index, var_index, coefficients[coefficient_idx]);
     }
 
+    output.SetCardinality(0);
+    return OperatorResultType::NEED_MORE_INPUT;
+  }
+
+  static OperatorFinalizeResultType
+  SetCoefficientsBulkFinal(ExecutionContext &context,
+                           TableFunctionInput &data_p, DataChunk &output) {
+    auto &local_state = data_p.local_state->Cast<BulkLocalState>();
+    auto &buffers = local_state.buffers;
+
+    idx_t batch_size = MinValue<idx_t>(buffers.size() - local_state.emitted,
+                                       STANDARD_VECTOR_SIZE);
+    auto loaded_vector = FlatVector::GetData<int64_t>(output.data[1]);
+    auto status_vector = FlatVector::GetData<string_t>(output.data[2]);
     for (idx_t i = 0; i < batch_size; i++) {
-      idx_t var_idx = current_row + i;
-      std::string var_name = model_info->variable_names[var_idx];
-      std::string index_str = var_name + "_" + std::to_string(var_idx);
+      auto &buffer = buffers[local_state.emitted + i];
+      if (buffer.model_info && !buffer.rows.empty()) {
+        auto &model_info = buffer.model_info;
+        std::lock_guard<HighsModelLock> guard(model_info->mutex);
+        ChargeModelMemory(
+            context.client, *model_info,
+            model_info->constraint_coefficients.ReserveBytes(
+                buffer.rows.size()));
+        // The buffer has the store's layout, so this is a copy per chunk
+        model_info->constraint_coefficients.Append(
+            buffer.rows.data(), buffer.cols.data(), buffer.values.data(),
+            buffer.rows.size());
+        for (size_t k = 0; k < buffer.rows.size(); k++) {
+          model_info->FingerprintCoefficient(buffer.rows[k], buffer.cols[k],
+                                             buffer.values[k]);
+        }
+        ChargeModelMemory(context.client, *model_info);
+      }
 
-      variable_name_vector[i] =
-          StringVector::AddString(output.data[0], var_name);
-      variable_index_vector[i] =
-          StringVector::AddString(output.data[1], index_str);
-      solution_value_vector[i] = global_state.solution_values.size() > var_idx
-                                     ? global_state.solution_values[var_idx]
-                                     : 0.0;
-      reduced_cost_vector[i] = global_state.reduced_costs.size() > var_idx
-                                   ? global_state.reduced_costs[var_idx]
-                                   : 0.0;
-      status_vector[i] = StringVector::AddString(output.data[4], status_str);
-    }
+      if (buffer.null_model) {
+        FlatVector::SetNull(output.data[0], i, true);
+      } else {
+        FlatVector::GetData<string_t>(output.data[0])[i] =
+            StringVector::AddString(output.data[0], buffer.model_name);
+      }
+      loaded_vector[i] = (int64_t)buffer.rows.size();
+      if (buffer.rejected == 0) {
+        status_vector[i] = string_t("SUCCESS");
+      } else {
+        status_vector[i] = StringVector::AddString(
+            output.data[2], "ERROR: " + std::to_string(buffer.rejected) +
+                                " coefficients rejected, first: " +
+                                buffer.first_error);
+      }
 
-    global_state.current_row += batch_size;
+      // Release the merged triplets right away
+      buffer.rows = std::vector<int>();
+      buffer.cols = std::vector<int>();
+      buffer.values = std::vector<double>();
+      buffer.charge.Resize(0);
+    }
+    output.SetCardinality(batch_size);
+    local_state.emitted += batch_size;
+    return local_state.emitted < buffers.size()
+               ? OperatorFinalizeResultType::HAVE_MORE_OUTPUT
+               : OperatorFinalizeResultType::FINISHED;
   }
 
-  static unique_ptr<FunctionData> SolveBind(ClientContext &context,
-                                            TableFunctionBindInput &input,
-                                            vector<LogicalType> &return_types,
-                                            vector<string> &names) {
-    auto result = make_uniq<HighsSolveData>();
-
-    // Extract parameters from input
-    if (input.inputs.size() != 1) {
+  static unique_ptr<FunctionData>
+  SetCoefficientsBulkBind(ClientContext &context, TableFunctionBindInput &input,
+                          vector<LogicalType> &return_types,
+                          vector<string> &names) {
+    if (input.input_table_types.size() != 4) {
       throw BinderException(
-          "highs_solve expects exactly 1 parameter: model_name");
+          "highs_set_coefficients expects a table with exactly 4 columns: "
+          "model_name, constraint_name, variable_name, coefficient");
     }
-
-    result->model_name = input.inputs[0].GetValue<string>();
+    auto result = make_uniq<HighsBulkBindData>();
+    result->id_keys = UsesIdKeys(input.input_table_types, {1, 2},
+                                 "highs_set_coefficients");
 
     // Define output schema
-    names.emplace_back("variable_name");
+    names.emplace_back("model_name");
     return_types.emplace_back(LogicalType::VARCHAR);
-    names.emplace_back("variable_index");
-    return_types.emplace_back(LogicalType::VARCHAR);
-    names.emplace_back("solution_value");
-    return_types.emplace_back(LogicalType::DOUBLE);
-    names.emplace_back("reduced_cost");
-    return_types.emplace_back(LogicalType::DOUBLE);
+    names.emplace_back("coefficients_loaded");
+    return_types.emplace_back(LogicalType::BIGINT);
     names.emplace_back("status");
     return_types.emplace_back(LogicalType::VARCHAR);
 
     return std::move(result);
   }
 
-  static unique_ptr<GlobalTableFunctionState>
-  SolveInit(ClientContext &context, TableFunctionInitInput &input) {
-    return make_uniq<HighsSolveGlobalState>();
+  static unique_ptr<LocalTableFunctionState>
+  SetCoefficientsBulkInitLocal(ExecutionContext &context,
+                               TableFunctionInitInput &input,
+                               GlobalTableFunctionState *global_state) {
+    bool id_keys = input.bind_data->Cast<HighsBulkBindData>().id_keys;
+    auto result = make_uniq<BulkLocalState>();
+    result->cast_chunk.Initialize(Allocator::Get(context.client),
+                                  BulkInputTypes(id_keys));
+    return std::move(result);
   }
 };
 
-static void LoadInternal(DuckDB &db) {
-  // Register HiGHS version functions
-  auto highs_version_function =
-      ScalarFunction("highs_version", {LogicalType::VARCHAR},
-                     LogicalType::VARCHAR, HighsVersionScalarFun);
-  ExtensionUtil::RegisterFunction(*db.instance, highs_version_function);
+// The key a single-row edit names its variable or constraint by: a VARCHAR
+// name, or the BIGINT id of a model keyed by ids
+struct HighsUpdateKey {
+  Value value;
 
-  auto highs_openssl_version_function =
-      ScalarFunction("highs_openssl_version", {LogicalType::VARCHAR},
-                     LogicalType::VARCHAR, HighsOpenSSLVersionScalarFun);
-  ExtensionUtil::RegisterFunction(*db.instance, highs_openssl_version_function);
+  bool IsId() const { return value.type().id() == LogicalTypeId::BIGINT; }
 
-  // Register optimization table functions
-  // highs_create_variables(model_name, variable_name, lower_bound, upper_bound,
-  // obj_coefficient, var_type)
-  TableFunction create_variables_function(
-      "highs_create_variables",
-      {LogicalType::VARCHAR, LogicalType::VARCHAR, LogicalType::DOUBLE,
-       LogicalType::DOUBLE, LogicalType::DOUBLE, LogicalType::VARCHAR},
-      HighsCreateVariablesFunction::CreateVariablesFunction,
-      HighsCreateVariablesFunction::CreateVariablesBind,
-      HighsCreateVariablesFunction::CreateVariablesInit);
-  ExtensionUtil::RegisterFunction(*db.instance, create_variables_function);
+  // As the key appears in error messages
+  std::string Describe() const {
+    return IsId() ? value.ToString() : "'" + value.ToString() + "'";
+  }
 
-  // highs_create_constraints(model_name, constraint_name, lower_bound,
-  // upper_bound)
-  TableFunction create_constraints_function(
-      "highs_create_constraints",
-      {LogicalType::VARCHAR, LogicalType::VARCHAR, LogicalType::DOUBLE,
-       LogicalType::DOUBLE},
-      HighsCreateConstraintsFunction::CreateConstraintsFunction,
-      HighsCreateConstraintsFunction::CreateConstraintsBind,
-      HighsCreateConstraintsFunction::CreateConstraintsInit);
-  ExtensionUtil::RegisterFunction(*db.instance, create_constraints_function);
+  // Index of the key among the model's names or ids, or -1 with the error
+  // status to report. The caller must hold the model mutex.
+  int Find(const HighsModelInfo &model_info, const HighsNameTable &names,
+           const HighsIdMap &ids, const char *kind,
+           const std::string &model_name, std::string &error) const {
+    bool id_key = IsId();
+    if (model_info.key_type != HighsKeyType::UNSET &&
+        (model_info.key_type == HighsKeyType::ID) != id_key) {
+      error = "ERROR: Model '" + model_name + "' is keyed by " +
+              (id_key ? "names, not by BIGINT ids"
+                      : "BIGINT ids, not by names");
+      return -1;
+    }
+    int index = id_key ? ids.Find(value.GetValue<int64_t>())
+                       : names.Find(value.GetValue<string>());
+    if (index < 0) {
+      error = std::string("ERROR: ") + kind + " " + Describe() +
+              " not found in model '" + model_name + "'";
+    }
+    return index;
+  }
+};
 
-  // highs_set_coefficients(model_name, constraint_name, variable_name,
+struct HighsUpdateVariableData : public TableFunctionData {
+  std::string model_name;
+  HighsUpdateKey variable;
+  Value lower_bound;
+  Value upper_bound;
+  Value obj_coefficient;
+};
+
+struct HighsUpdateConstraintData : public TableFunctionData {
+  std::string model_name;
+  HighsUpdateKey constraint;
+  Value lower_bound;
+  Value upper_bound;
+};
+
+static void
+SetUpdateSchema(const char *name_column, vector<LogicalType> &return_types,
+                vector<string> &names,
+                const LogicalType &key_type = LogicalType::VARCHAR) {
+  names.emplace_back(name_column);
+  return_types.emplace_back(key_type);
+  names.emplace_back("status");
+  return_types.emplace_back(LogicalType::VARCHAR);
+}
+
+static void SetUpdateRow(DataChunk &output, const Value &key,
+                         const std::string &status) {
+  output.SetCardinality(1);
+  output.SetValue(0, 0, key);
+  FlatVector::GetData<string_t>(output.data[1])[0] =
+      StringVector::AddString(output.data[1], status);
+}
+
+static void SetUpdateRow(DataChunk &output, const std::string &name,
+                         const std::string &status) {
+  SetUpdateRow(output, Value(name), status);
+}
+
+// Table functions editing existing variables and constraints in place:
+// highs_update_variable(model_name, variable_name, lower_bound, upper_bound,
+// obj_coefficient) and highs_update_constraint(model_name, constraint_name,
+// lower_bound, upper_bound). A model keyed by ids takes the BIGINT id in
+// place of the name. NULL leaves a value unchanged. The next solve sends
+// the edits to the model's live solver as deltas.
+struct HighsUpdateFunction {
+  static void UpdateVariableFunction(ClientContext &context,
+                                     TableFunctionInput &data_p,
+                                     DataChunk &output) {
+    auto &bind_data = data_p.bind_data->Cast<HighsUpdateVariableData>();
+    auto &global_state = data_p.global_state->Cast<SingleRowGlobalState>();
+
+    // If we've already output a row, we're done
+    if (global_state.finished) {
+      output.SetCardinality(0);
+      return;
+    }
+    global_state.finished = true;
+
+    auto model_info =
+        HighsModelRegistry::Instance().GetModel(bind_data.model_name);
+    auto &key = bind_data.variable.value;
+    if (!model_info) {
+      SetUpdateRow(output, key,
+                   "ERROR: Model '" + bind_data.model_name + "' not found");
+      return;
+    }
+
+    std::lock_guard<HighsModelLock> guard(model_info->mutex);
+    std::string error;
+    int var_index = bind_data.variable.Find(
+        *model_info, model_info->variable_names, model_info->variable_ids,
+        "Variable", bind_data.model_name, error);
+    if (var_index < 0) {
+      SetUpdateRow(output, key, error);
+      return;
+    }
+
+    model_info->FingerprintVariable(var_index, -1);
+    if (!bind_data.lower_bound.IsNull()) {
+      model_info->var_lower_bounds[var_index] =
+          bind_data.lower_bound.GetValue<double>();
+    }
+    if (!bind_data.upper_bound.IsNull()) {
+      model_info->var_upper_bounds[var_index] =
+          bind_data.upper_bound.GetValue<double>();
+    }
+    if (!bind_data.obj_coefficient.IsNull()) {
+      model_info->obj_coefficients[var_index] =
+          bind_data.obj_coefficient.GetValue<double>();
+    }
+    model_info->FingerprintVariable(var_index, 1);
+    model_info->MarkVariableDirty(var_index);
+    SetUpdateRow(output, key, "SUCCESS");
+  }
+
+  static void UpdateConstraintFunction(ClientContext &context,
+                                       TableFunctionInput &data_p,
+                                       DataChunk &output) {
+    auto &bind_data = data_p.bind_data->Cast<HighsUpdateConstraintData>();
+    auto &global_state = data_p.global_state->Cast<SingleRowGlobalState>();
+
+    // If we've already output a row, we're done
+    if (global_state.finished) {
+      output.SetCardinality(0);
+      return;
+    }
+    global_state.finished = true;
+
+    auto model_info =
+        HighsModelRegistry::Instance().GetModel(bind_data.model_name);
+    auto &key = bind_data.constraint.value;
+    if (!model_info) {
+      SetUpdateRow(output, key,
+                   "ERROR: Model '" + bind_data.model_name + "' not found");
+      return;
+    }
+
+    std::lock_guard<HighsModelLock> guard(model_info->mutex);
+    std::string error;
+    int constraint_index = bind_data.constraint.Find(
+        *model_info, model_info->constraint_names, model_info->constraint_ids,
+        "Constraint", bind_data.model_name, error);
+    if (constraint_index < 0) {
+      SetUpdateRow(output, key, error);
+      return;
+    }
+
+    model_info->FingerprintConstraint(constraint_index, -1);
+    if (!bind_data.lower_bound.IsNull()) {
+      model_info->constraint_lower_bounds[constraint_index] =
+          bind_data.lower_bound.GetValue<double>();
+    }
+    if (!bind_data.upper_bound.IsNull()) {
+      model_info->constraint_upper_bounds[constraint_index] =
+          bind_data.upper_bound.GetValue<double>();
+    }
+    model_info->FingerprintConstraint(constraint_index, 1);
+    model_info->MarkConstraintDirty(constraint_index);
+    SetUpdateRow(output, key, "SUCCESS");
+  }
+
+  static unique_ptr<FunctionData>
+  UpdateVariableBind(ClientContext &context, TableFunctionBindInput &input,
+                     vector<LogicalType> &return_types,
+                     vector<string> &names) {
+    auto result = make_uniq<HighsUpdateVariableData>();
+
+    if (input.inputs.size() != 5) {
+      throw BinderException(
+          "highs_update_variable expects exactly 5 parameters: model_name, "
+          "variable_name, lower_bound, upper_bound, obj_coefficient");
+    }
+
+    result->model_name = input.inputs[0].GetValue<string>();
+    result->variable.value = input.inputs[1];
+    result->lower_bound = input.inputs[2];
+    result->upper_bound = input.inputs[3];
+    result->obj_coefficient = input.inputs[4];
+
+    if (result->variable.IsId()) {
+      SetUpdateSchema("variable_id", return_types, names,
+                      LogicalType::BIGINT);
+    } else {
+      SetUpdateSchema("variable_name", return_types, names);
+    }
+    return std::move(result);
+  }
+
+  static unique_ptr<FunctionData>
+  UpdateConstraintBind(ClientContext &context, TableFunctionBindInput &input,
+                       vector<LogicalType> &return_types,
+                       vector<string> &names) {
+    auto result = make_uniq<HighsUpdateConstraintData>();
+
+    if (input.inputs.size() != 4) {
+      throw BinderException(
+          "highs_update_constraint expects exactly 4 parameters: model_name, "
+          "constraint_name, lower_bound, upper_bound");
+    }
+
+    result->model_name = input.inputs[0].GetValue<string>();
+    result->constraint.value = input.inputs[1];
+    result->lower_bound = input.inputs[2];
+    result->upper_bound = input.inputs[3];
+
+    if (result->constraint.IsId()) {
+      SetUpdateSchema("constraint_id", return_types, names,
+                      LogicalType::BIGINT);
+    } else {
+      SetUpdateSchema("constraint_name", return_types, names);
+    }
+    return std::move(result);
+  }
+
+  static unique_ptr<GlobalTableFunctionState>
+  UpdateInit(ClientContext &context, TableFunctionInitInput &input) {
+    return make_uniq<SingleRowGlobalState>();
+  }
+};
+
+struct HighsSetOptionData : public TableFunctionData {
+  std::string model_name;
+  std::string option_name;
+  Value value;
+};
+
+// Table function adding a HiGHS option to a model's profile:
+// highs_set_option(model_name, option_name, value), e.g. 'time_limit',
+// 'mip_rel_gap', 'solver' or 'threads'. The value is given as text, as in a
+// HiGHS options file; NULL removes the option from the profile. Every later
+// solve of the model starts from the HiGHS defaults plus the profile.
+struct HighsSetOptionFunction {
+  static void SetOptionFunction(ClientContext &context,
+                                TableFunctionInput &data_p,
+                                DataChunk &output) {
+    auto &bind_data = data_p.bind_data->Cast<HighsSetOptionData>();
+    auto &global_state = data_p.global_state->Cast<SingleRowGlobalState>();
+
+    // If we've already output a row, we're done
+    if (global_state.finished) {
+      output.SetCardinality(0);
+      return;
+    }
+    global_state.finished = true;
+
+    std::string value;
+    if (!bind_data.value.IsNull()) {
+      value = bind_data.value.ToString();
+      try {
+        ValidateHighsOption(bind_data.option_name, value);
+      } catch (const std::exception &e) {
+        SetUpdateRow(output, bind_data.option_name,
+                     std::string("ERROR: ") + e.what());
+        return;
+      }
+    }
+
+    auto model_info =
+        HighsModelRegistry::Instance().GetOrCreateModel(bind_data.model_name);
+    std::lock_guard<HighsModelLock> guard(model_info->mutex);
+    if (bind_data.value.IsNull()) {
+      model_info->options.erase(bind_data.option_name);
+    } else {
+      model_info->options[bind_data.option_name] = value;
+    }
+    SetUpdateRow(output, bind_data.option_name, "SUCCESS");
+  }
+
+  static unique_ptr<FunctionData>
+  SetOptionBind(ClientContext &context, TableFunctionBindInput &input,
+                vector<LogicalType> &return_types, vector<string> &names) {
+    auto result = make_uniq<HighsSetOptionData>();
+
+    if (input.inputs.size() != 3) {
+      throw BinderException(
+          "highs_set_option expects exactly 3 parameters: model_name, "
+          "option_name, value");
+    }
+
+    result->model_name = input.inputs[0].GetValue<string>();
+    result->option_name = input.inputs[1].GetValue<string>();
+    result->value = input.inputs[2];
+
+    SetUpdateSchema("option_name", return_types, names);
+    return std::move(result);
+  }
+
+  static unique_ptr<GlobalTableFunctionState>
+  SetOptionInit(ClientContext &context, TableFunctionInitInput &input) {
+    return make_uniq<SingleRowGlobalState>();
+  }
+};
+
+// MPS text for exchange with other tools, or a binary snapshot
+enum class HighsModelFileFormat : uint8_t { MPS, SNAPSHOT };
+
+struct HighsModelFileData : public TableFunctionData {
+  std::string model_name;
+  std::string path;
+  HighsModelFileFormat format = HighsModelFileFormat::MPS;
+};
+
+static void SetModelFileSchema(vector<LogicalType> &return_types,
+                               vector<string> &names) {
+  names.emplace_back("model_name");
+  return_types.emplace_back(LogicalType::VARCHAR);
+  names.emplace_back("num_variables");
+  return_types.emplace_back(LogicalType::BIGINT);
+  names.emplace_back("num_constraints");
+  return_types.emplace_back(LogicalType::BIGINT);
+  names.emplace_back("num_nonzeros");
+  return_types.emplace_back(LogicalType::BIGINT);
+  names.emplace_back("status");
+  return_types.emplace_back(LogicalType::VARCHAR);
+}
+
+static void SetModelFileRow(DataChunk &output, const std::string &model_name,
+                            const HighsModelFileStats &stats,
+                            const std::string &status) {
+  output.SetCardinality(1);
+  output.SetValue(0, 0, Value(model_name));
+  output.SetValue(1, 0, Value::BIGINT((int64_t)stats.num_columns));
+  output.SetValue(2, 0, Value::BIGINT((int64_t)stats.num_rows));
+  output.SetValue(3, 0, Value::BIGINT((int64_t)stats.num_nonzeros));
+  output.SetValue(4, 0, Value(status));
+}
+
+// Table functions moving whole models in and out of files:
+// highs_read_model(model_name, path) loads an MPS file into a new or empty
+// model and highs_write_model(model_name, path) writes one out;
+// highs_load_model and highs_save_model do the same with binary snapshots,
+// which also keep the key type, options and last basis. Files go through
+// DuckDB's FileSystem, so .gz paths and registered file systems work; see
+// highs_mps.hpp and highs_snapshot.hpp for the formats.
+struct HighsModelFileFunction {
+  static void ReadModelFunction(ClientContext &context,
+                                TableFunctionInput &data_p,
+                                DataChunk &output) {
+    auto &bind_data = data_p.bind_data->Cast<HighsModelFileData>();
+    auto &global_state = data_p.global_state->Cast<SingleRowGlobalState>();
+
+    // If we've already output a row, we're done
+    if (global_state.finished) {
+      output.SetCardinality(0);
+      return;
+    }
+    global_state.finished = true;
+
+    auto model_info =
+        HighsModelRegistry::Instance().GetOrCreateModel(bind_data.model_name);
+    std::lock_guard<std::timed_mutex> solver_guard(model_info->solver_mutex);
+    std::lock_guard<HighsModelLock> guard(model_info->mutex);
+    HighsModelFileStats stats;
+    if (model_info->next_var_index > 0 ||
+        model_info->next_constraint_index > 0) {
+      SetModelFileRow(output, bind_data.model_name, stats,
+                      "ERROR: Model '" + bind_data.model_name +
+                          "' is not empty");
+      return;
+    }
+    // The readers charge the arrays before allocating them, so a file too
+    // large for memory_limit fails before it is all in memory
+    model_info->model_memory.Attach(context);
+    try {
+      if (bind_data.format == HighsModelFileFormat::SNAPSHOT) {
+        stats = LoadModelSnapshot(context, bind_data.path, *model_info);
+      } else {
+        model_info->ClaimKeyType(HighsKeyType::NAME, bind_data.model_name);
+        stats = ReadMpsModel(context, bind_data.path, *model_info);
+      }
+      // Also counts the coefficients, which the charge needs
+      model_info->RebuildFingerprint();
+      ChargeModelMemory(context, *model_info);
+    } catch (const std::exception &e) {
+      // The readers clear the model on failure; a model over the memory
+      // limit is dropped the same way
+      model_info->Clear();
+      model_info->model_memory.Resize(0);
+      SetModelFileRow(output, bind_data.model_name, stats,
+                      std::string("ERROR: ") + e.what());
+      return;
+    }
+    // A solver built for the empty model would miss the objective offset
+    model_info->solver.reset();
+    model_info->solver_memory.Resize(0);
+    SetModelFileRow(output, bind_data.model_name, stats, "SUCCESS");
+  }
+
+  static void WriteModelFunction(ClientContext &context,
+                                 TableFunctionInput &data_p,
+                                 DataChunk &output) {
+    auto &bind_data = data_p.bind_data->Cast<HighsModelFileData>();
+    auto &global_state = data_p.global_state->Cast<SingleRowGlobalState>();
+
+    // If we've already output a row, we're done
+    if (global_state.finished) {
+      output.SetCardinality(0);
+      return;
+    }
+    global_state.finished = true;
+
+    HighsModelFileStats stats;
+    auto model_info =
+        HighsModelRegistry::Instance().GetModel(bind_data.model_name);
+    if (!model_info) {
+      SetModelFileRow(output, bind_data.model_name, stats,
+                      "ERROR: Model '" + bind_data.model_name +
+                          "' not found");
+      return;
+    }
+
+    // Snapshots read the solver's basis, which solves write
+    std::unique_lock<std::timed_mutex> solver_guard(model_info->solver_mutex,
+                                                    std::defer_lock);
+    if (bind_data.format == HighsModelFileFormat::SNAPSHOT) {
+      solver_guard.lock();
+    }
+    HighsSharedLock guard(model_info->mutex);
+    try {
+      if (bind_data.format == HighsModelFileFormat::SNAPSHOT) {
+        // Keep the basis of the last solve if the solver still has the
+        // model's shape; bound and cost edits leave it a valid warm start
+        HighsBasis basis = model_info->start_basis;
+        auto &solver = model_info->solver;
+        if (solver &&
+            model_info->synced_num_col == model_info->next_var_index &&
+            model_info->synced_num_row == model_info->next_constraint_index) {
+          basis = solver->getBasis();
+        }
+        stats = SaveModelSnapshot(context, bind_data.path, *model_info,
+                                  &basis);
+      } else {
+        stats = WriteMpsModel(context, bind_data.path, bind_data.model_name,
+                              *model_info);
+      }
+    } catch (const std::exception &e) {
+      SetModelFileRow(output, bind_data.model_name, stats,
+                      std::string("ERROR: ") + e.what());
+      return;
+    }
+    SetModelFileRow(output, bind_data.model_name, stats, "SUCCESS");
+  }
+
+  static unique_ptr<FunctionData>
+  ModelFileBind(ClientContext &context, TableFunctionBindInput &input,
+                vector<LogicalType> &return_types, vector<string> &names) {
+    auto result = make_uniq<HighsModelFileData>();
+
+    if (input.inputs.size() != 2) {
+      throw BinderException(input.table_function.name +
+                            " expects exactly 2 parameters: model_name, path");
+    }
+
+    result->model_name = input.inputs[0].GetValue<string>();
+    result->path = input.inputs[1].GetValue<string>();
+
+    SetModelFileSchema(return_types, names);
+    return std::move(result);
+  }
+
+  static unique_ptr<FunctionData>
+  SnapshotBind(ClientContext &context, TableFunctionBindInput &input,
+               vector<LogicalType> &return_types, vector<string> &names) {
+    auto result = ModelFileBind(context, input, return_types, names);
+    result->Cast<HighsModelFileData>().format =
+        HighsModelFileFormat::SNAPSHOT;
+    return result;
+  }
+
+  static unique_ptr<GlobalTableFunctionState>
+  ModelFileInit(ClientContext &context, TableFunctionInitInput &input) {
+    return make_uniq<SingleRowGlobalState>();
+  }
+};
+
+// Table function reporting the solve result cache: highs_cache_stats()
+// returns one row with its entries, capacity, hits, misses and evictions
+struct HighsCacheStatsFunction {
+  static void CacheStatsFunction(ClientContext &context,
+                                 TableFunctionInput &data_p,
+                                 DataChunk &output) {
+    auto &global_state = data_p.global_state->Cast<SingleRowGlobalState>();
+    if (global_state.finished) {
+      output.SetCardinality(0);
+      return;
+    }
+    global_state.finished = true;
+
+    auto stats = HighsResultCache::Instance().Stats();
+    output.SetCardinality(1);
+    output.SetValue(0, 0, Value::BIGINT((int64_t)stats.entries));
+    output.SetValue(1, 0, Value::BIGINT((int64_t)stats.capacity));
+    output.SetValue(2, 0, Value::BIGINT((int64_t)stats.hits));
+    output.SetValue(3, 0, Value::BIGINT((int64_t)stats.misses));
+    output.SetValue(4, 0, Value::BIGINT((int64_t)stats.evictions));
+  }
+
+  static unique_ptr<FunctionData>
+  CacheStatsBind(ClientContext &context, TableFunctionBindInput &input,
+                 vector<LogicalType> &return_types, vector<string> &names) {
+    names.emplace_back("entries");
+    return_types.emplace_back(LogicalType::BIGINT);
+    names.emplace_back("capacity");
+    return_types.emplace_back(LogicalType::BIGINT);
+    names.emplace_back("hits");
+    return_types.emplace_back(LogicalType::BIGINT);
+    names.emplace_back("misses");
+    return_types.emplace_back(LogicalType::BIGINT);
+    names.emplace_back("evictions");
+    return_types.emplace_back(LogicalType::BIGINT);
+    return make_uniq<TableFunctionData>();
+  }
+
+  static unique_ptr<GlobalTableFunctionState>
+  CacheStatsInit(ClientContext &context, TableFunctionInitInput &input) {
+    return make_uniq<SingleRowGlobalState>();
+  }
+};
+
+static const char *ModelStatusToString(HighsModelStatus status) {
+  switch (status) {
+  case HighsModelStatus::kOptimal:
+    return "Optimal";
+  case HighsModelStatus::kInfeasible:
+    return "Infeasible";
+  case HighsModelStatus::kUnbounded:
+    return "Unbounded";
+  case HighsModelStatus::kInterrupt:
+    return "Interrupted";
+  case HighsModelStatus::kTimeLimit:
+    return "TimeLimit";
+  default:
+    return "Unknown";
+  }
+}
+
+// Emit a single error row in the projected solution schema
+static void SetSolveErrorRow(DataChunk &output,
+                             HighsSolveProjection &projection,
+                             const std::string &message) {
+  output.SetCardinality(1);
+  auto &columns = projection.Columns();
+  for (idx_t col = 0; col < columns.size(); col++) {
+    auto &vector = output.data[col];
+    switch (columns[col]) {
+    case HighsSolveColumn::VARIABLE_NAME:
+    case HighsSolveColumn::CONSTRAINT_NAME:
+      FlatVector::GetData<string_t>(vector)[0] =
+          StringVector::AddString(vector, "N/A");
+      break;
+    case HighsSolveColumn::VARIABLE_INDEX:
+      FlatVector::GetData<string_t>(vector)[0] =
+          StringVector::AddString(vector, "ERROR");
+      break;
+    case HighsSolveColumn::SOLUTION_VALUE:
+    case HighsSolveColumn::REDUCED_COST:
+    case HighsSolveColumn::ROW_ACTIVITY:
+    case HighsSolveColumn::DUAL_VALUE:
+    case HighsSolveColumn::SLACK:
+      FlatVector::GetData<double>(vector)[0] = 0.0;
+      break;
+    case HighsSolveColumn::STATUS:
+      FlatVector::GetData<string_t>(vector)[0] =
+          StringVector::AddString(vector, "ERROR: " + message);
+      break;
+    default:
+      FlatVector::SetNull(vector, 0, true);
+      break;
+    }
+  }
+  projection.Filter(output);
+}
+
+// Fill the variable_name and variable_index columns for count columns from
+// first on. Id-keyed models have no names, so both are NULL there.
+static void EmitColumnNames(const HighsKeySnapshot &columns, idx_t first,
+                            idx_t count, Vector &name_vector,
+                            Vector &index_vector) {
+  if (columns.names.empty()) {
+    FlatVector::Validity(name_vector).SetAllInvalid(count);
+    FlatVector::Validity(index_vector).SetAllInvalid(count);
+    return;
+  }
+
+  // Names point straight into the model's arena
+  AttachNameArena(name_vector, columns.name_arena);
+  auto names = FlatVector::GetData<string_t>(name_vector);
+  auto indices = FlatVector::GetData<string_t>(index_vector);
+  for (idx_t i = 0; i < count; i++) {
+    names[i] = columns.names[first + i];
+    indices[i] = FormatIndexedName(index_vector, names[i], first + i);
+  }
+}
+
+// Copy count doubles from first on into a flat vector
+static void EmitDoubles(Vector &vector, const std::vector<double> &values,
+                        idx_t first, idx_t count) {
+  std::memcpy(FlatVector::GetData<double>(vector), values.data() + first,
+              count * sizeof(double));
+}
+
+// Point a string vector at count names from first on, or make it NULL for
+// id-keyed models
+static void EmitNames(Vector &vector, const HighsKeySnapshot &keys,
+                      idx_t first, idx_t count) {
+  if (keys.names.empty()) {
+    FlatVector::Validity(vector).SetAllInvalid(count);
+    return;
+  }
+  // Names point straight into the model's arena
+  AttachNameArena(vector, keys.name_arena);
+  std::memcpy(FlatVector::GetData<string_t>(vector), keys.names.data() + first,
+              count * sizeof(string_t));
+}
+
+// Fill one batch of result rows, producing only the projected columns.
+// Doubles are copied straight out of the result and the status is a
+// constant vector.
+static void FillSolutionBatch(DataChunk &output,
+                              const HighsSolveGlobalState &global_state,
+                              idx_t first, idx_t count) {
+  auto &result = *global_state.result;
+  auto &keys = global_state.output == HighsSolveOutput::CONSTRAINTS
+                   ? result.rows
+                   : result.columns;
+  auto &columns = global_state.projection.Columns();
+  output.SetCardinality(count);
+  for (idx_t col = 0; col < columns.size(); col++) {
+    auto &vector = output.data[col];
+    switch (columns[col]) {
+    case HighsSolveColumn::VARIABLE_NAME:
+    case HighsSolveColumn::CONSTRAINT_NAME:
+      EmitNames(vector, keys, first, count);
+      break;
+    case HighsSolveColumn::VARIABLE_INDEX: {
+      if (keys.names.empty()) {
+        FlatVector::Validity(vector).SetAllInvalid(count);
+        break;
+      }
+      auto indices = FlatVector::GetData<string_t>(vector);
+      for (idx_t i = 0; i < count; i++) {
+        indices[i] =
+            FormatIndexedName(vector, keys.names[first + i], first + i);
+      }
+      break;
+    }
+    case HighsSolveColumn::VARIABLE_ID: {
+      auto ids = FlatVector::GetData<int64_t>(vector);
+      for (idx_t i = 0; i < count; i++) {
+        ids[i] = keys.Id(first + i);
+      }
+      break;
+    }
+    case HighsSolveColumn::CONSTRAINT_ID:
+      // Only id-keyed models have constraint ids
+      if (keys.ids.empty()) {
+        FlatVector::Validity(vector).SetAllInvalid(count);
+      } else {
+        std::memcpy(FlatVector::GetData<int64_t>(vector),
+                    keys.ids.data() + first, count * sizeof(int64_t));
+      }
+      break;
+    case HighsSolveColumn::SOLUTION_VALUE:
+      EmitDoubles(vector, result.col_value, first, count);
+      break;
+    case HighsSolveColumn::REDUCED_COST:
+      EmitDoubles(vector, result.col_dual, first, count);
+      break;
+    case HighsSolveColumn::ROW_ACTIVITY:
+      EmitDoubles(vector, result.row_value, first, count);
+      break;
+    case HighsSolveColumn::DUAL_VALUE:
+      EmitDoubles(vector, result.row_dual, first, count);
+      break;
+    case HighsSolveColumn::SLACK:
+      EmitDoubles(vector, result.row_slack, first, count);
+      break;
+    case HighsSolveColumn::STATUS:
+      vector.SetVectorType(VectorType::CONSTANT_VECTOR);
+      ConstantVector::GetData<string_t>(vector)[0] = StringVector::AddString(
+          vector, ModelStatusToString(result.model_status));
+      break;
+    case HighsSolveColumn::COLUMN_INDEX:
+    case HighsSolveColumn::ROW_INDEX: {
+      auto indices = FlatVector::GetData<int64_t>(vector);
+      for (idx_t i = 0; i < count; i++) {
+        indices[i] = (int64_t)(first + i);
+      }
+      break;
+    }
+    }
+  }
+}
+
+// Emit the next non-empty batch of result rows that pass the pushed-down
+// filters, or an empty chunk once every row has been emitted
+static void EmitSolutionBatch(DataChunk &output,
+                              HighsSolveGlobalState &global_state) {
+  auto &result = *global_state.result;
+  idx_t num_rows = global_state.output == HighsSolveOutput::CONSTRAINTS
+                       ? result.rows.count
+                       : result.columns.count;
+  while (global_state.current_row < num_rows) {
+    idx_t first = global_state.current_row;
+    idx_t batch_size = std::min(num_rows - first, (idx_t)STANDARD_VECTOR_SIZE);
+    global_state.current_row += batch_size;
+
+    output.Reset();
+    FillSolutionBatch(output, global_state, first, batch_size);
+    global_state.emitted = (double)global_state.current_row / num_rows;
+    global_state.projection.Filter(output);
+    if (output.size() > 0) {
+      return;
+    }
+  }
+  global_state.emitted = 1;
+  output.SetCardinality(0);
+}
+
+// Interrupting the query stops HiGHS at its next interrupt check; the
+// query then fails as interrupted rather than returning a partial result
+static void CheckInterrupted(ClientContext &context,
+                             const HighsSolveResult &result) {
+  if (context.interrupted &&
+      result.model_status == HighsModelStatus::kInterrupt) {
+    throw InterruptException();
+  }
+}
+
+// Progress bar for the solution scans: the solve counts for 90%, by the
+// monitor's estimate (or, decomposed, the blocks handed out), and emitting
+// the rows for the rest
+static double SolveProgress(ClientContext &context,
+                            const FunctionData *bind_data,
+                            const GlobalTableFunctionState *global_state) {
+  auto &state = global_state->Cast<HighsSolveGlobalState>();
+  double emitted = state.emitted;
+  if (emitted >= 0) {
+    return 90 + 10 * emitted;
+  }
+  if (bind_data && bind_data->Cast<HighsSolveData>().decomposed) {
+    return 90 * state.blocks.Fraction();
+  }
+  return 90 * state.monitor.Progress();
+}
+
+// Table function for solving model and returning results
+struct HighsSolveFunction {
+  static void SolveFunction(ClientContext &context, TableFunctionInput &data_p,
+                            DataChunk &output) {
+    auto &bind_data = data_p.bind_data->Cast<HighsSolveData>();
+    auto &global_state = data_p.global_state->Cast<HighsSolveGlobalState>();
+
+    if (global_state.finished) {
+      output.SetCardinality(0);
+      return;
+    }
+
+    if (!global_state.result && bind_data.job_id >= 0) {
+      try {
+        global_state.result =
+            HighsJobManager::Instance().Result(bind_data.job_id);
+      } catch (const std::exception &e) {
+        SetSolveErrorRow(output, global_state.projection, e.what());
+        global_state.finished = true;
+        return;
+      }
+    }
+
+    // Solve the model if not already solved
+    if (!global_state.result) {
+      // Get model from registry
+      auto model_info =
+          HighsModelRegistry::Instance().GetModel(bind_data.model_name);
+      if (!model_info) {
+        SetSolveErrorRow(output, global_state.projection,
+                         "Model '" + bind_data.model_name + "' not found");
+        global_state.finished = true;
+        return;
+      }
+      global_state.monitor.WatchInterrupt(&context.interrupted);
+      auto settings = HighsThreadSettings::FromContext(context);
+      try {
+        global_state.result =
+            bind_data.decomposed
+                ? SolveModelDecomposed(*model_info, settings,
+                                       bind_data.min_block_size,
+                                       &context.interrupted,
+                                       &global_state.blocks)
+                : SolveModel(*model_info, settings, &global_state.monitor);
+      } catch (const InterruptException &) {
+        throw;
+      } catch (const std::exception &e) {
+        SetSolveErrorRow(output, global_state.projection, e.what());
+        global_state.finished = true;
+        return;
+      }
+      CheckInterrupted(context, *global_state.result);
+      global_state.model_info = std::move(model_info);
+    }
+
+    HighsStopwatch emission;
+    EmitSolutionBatch(output, global_state);
+    global_state.emission_time += emission.Seconds();
+    if (output.size() == 0 && global_state.model_info) {
+      global_state.model_info->solve_log.AddEmission(
+          global_state.result->solve_id, global_state.emission_time);
+      global_state.model_info.reset();
+    }
+  }
+
+  static unique_ptr<FunctionData>
+  BindOutput(TableFunctionBindInput &input, HighsSolveOutput output,
+             const char *function_name, vector<LogicalType> &return_types,
+             vector<string> &names) {
+    auto result = make_uniq<HighsSolveData>();
+
+    // Extract parameters from input
+    if (input.inputs.size() != 1) {
+      throw BinderException(std::string(function_name) +
+                            " expects exactly 1 parameter: model_name");
+    }
+
+    result->model_name = input.inputs[0].GetValue<string>();
+    result->output = output;
+
+    // Define output schema
+    SetSolveSchema(SolveSchema(output), return_types, names);
+
+    return std::move(result);
+  }
+
+  static unique_ptr<FunctionData> SolveBind(ClientContext &context,
+                                            TableFunctionBindInput &input,
+                                            vector<LogicalType> &return_types,
+                                            vector<string> &names) {
+    return BindOutput(input, HighsSolveOutput::VARIABLES, "highs_solve",
+                      return_types, names);
+  }
+
+  // highs_solve_ids(model_name): the same solve, keyed by variable id for
+  // models loaded by id. Name-keyed models report column indices as ids.
+  static unique_ptr<FunctionData>
+  SolveIdsBind(ClientContext &context, TableFunctionBindInput &input,
+               vector<LogicalType> &return_types, vector<string> &names) {
+    return BindOutput(input, HighsSolveOutput::VARIABLE_IDS,
+                      "highs_solve_ids", return_types, names);
+  }
+
+  // highs_solve_constraints(model_name): row activity, dual value and slack
+  // of every constraint, from the same solve highs_solve reads
+  static unique_ptr<FunctionData>
+  SolveConstraintsBind(ClientContext &context, TableFunctionBindInput &input,
+                       vector<LogicalType> &return_types,
+                       vector<string> &names) {
+    return BindOutput(input, HighsSolveOutput::CONSTRAINTS,
+                      "highs_solve_constraints", return_types, names);
+  }
+
+  // highs_solve_decomposed(model_name, min_block_size := 1024): the
+  // highs_solve rows, solving each independent block of the model as its
+  // own problem in parallel. Smaller blocks are packed up to min_block_size
+  // columns plus nonzeros.
+  static unique_ptr<FunctionData>
+  SolveDecomposedBind(ClientContext &context, TableFunctionBindInput &input,
+                      vector<LogicalType> &return_types,
+                      vector<string> &names) {
+    auto result =
+        BindOutput(input, HighsSolveOutput::VARIABLES,
+                   "highs_solve_decomposed", return_types, names);
+    auto &solve_data = result->Cast<HighsSolveData>();
+    solve_data.decomposed = true;
+    auto entry = input.named_parameters.find("min_block_size");
+    if (entry != input.named_parameters.end() && !entry->second.IsNull()) {
+      solve_data.min_block_size = entry->second.GetValue<uint64_t>();
+    }
+    return result;
+  }
+
+  // highs_job_solution(job_id): the highs_solve rows of a background job,
+  // without solving again
+  static unique_ptr<FunctionData>
+  JobSolutionBind(ClientContext &context, TableFunctionBindInput &input,
+                  vector<LogicalType> &return_types, vector<string> &names) {
+    auto result = make_uniq<HighsSolveData>();
+    if (input.inputs.size() != 1 || input.inputs[0].IsNull()) {
+      throw BinderException(
+          "highs_job_solution expects exactly 1 parameter: job_id");
+    }
+    result->job_id = input.inputs[0].GetValue<int64_t>();
+    SetSolveSchema(SolveSchema(HighsSolveOutput::VARIABLES), return_types,
+                   names);
+    return std::move(result);
+  }
+
+  static unique_ptr<GlobalTableFunctionState>
+  SolveInit(ClientContext &context, TableFunctionInitInput &input) {
+    auto &bind_data = input.bind_data->Cast<HighsSolveData>();
+    auto result = make_uniq<HighsSolveGlobalState>();
+    result->output = bind_data.output;
+    result->projection.Initialize(context, input,
+                                  SolveSchema(bind_data.output));
+    return std::move(result);
+  }
+};
+
+struct HighsModelStatsData : public TableFunctionData {
+  std::string model_name;
+};
+
+static unique_ptr<FunctionData> BindModelName(TableFunctionBindInput &input,
+                                              const char *function_name) {
+  if (input.inputs.size() != 1 || input.inputs[0].IsNull()) {
+    throw BinderException(std::string(function_name) +
+                          " expects exactly 1 parameter: model_name");
+  }
+  auto result = make_uniq<HighsModelStatsData>();
+  result->model_name = input.inputs[0].GetValue<string>();
+  return std::move(result);
+}
+
+// DOUBLE for a profile time, NULL if the phase was not measured
+static Value ProfileTime(double seconds) {
+  return std::isnan(seconds) ? Value(LogicalType::DOUBLE)
+                             : Value::DOUBLE(seconds);
+}
+
+// Monitoring functions, cheap enough to poll:
+// highs_model_stats(model_name) returns one row with the model's size and
+// the bytes held by each of its structures; solver_bytes and result_bytes
+// are NULL while the model is being solved. highs_solve_profile(model_name)
+// returns one row per recent solve of the model (see HighsSolveLog) with
+// the wall time of each phase and what HiGHS reported for it.
+struct HighsProfileFunctions {
+  static void ModelStatsFunction(ClientContext &context,
+                                 TableFunctionInput &data_p,
+                                 DataChunk &output) {
+    auto &bind_data = data_p.bind_data->Cast<HighsModelStatsData>();
+    auto &global_state = data_p.global_state->Cast<SingleRowGlobalState>();
+    if (global_state.finished) {
+      output.SetCardinality(0);
+      return;
+    }
+    global_state.finished = true;
+
+    output.SetCardinality(1);
+    output.SetValue(0, 0, Value(bind_data.model_name));
+    idx_t status_col = output.ColumnCount() - 1;
+    auto model_info =
+        HighsModelRegistry::Instance().GetModel(bind_data.model_name);
+    if (!model_info) {
+      for (idx_t col = 1; col < status_col; col++) {
+        output.SetValue(col, 0, Value(LogicalType::BIGINT));
+      }
+      output.SetValue(status_col, 0,
+                      Value("ERROR: Model '" + bind_data.model_name +
+                            "' not found"));
+      return;
+    }
+
+    auto stats = ComputeModelStats(*model_info);
+    idx_t total = stats.variable_key_bytes + stats.constraint_key_bytes +
+                  stats.objective_bytes + stats.bound_bytes +
+                  stats.coefficient_bytes + stats.type_bytes +
+                  stats.solver_bytes + stats.result_bytes;
+    idx_t counts[] = {stats.num_variables,        stats.num_constraints,
+                      stats.num_nonzeros,         stats.num_integer,
+                      stats.variable_key_bytes,   stats.constraint_key_bytes,
+                      stats.objective_bytes,      stats.bound_bytes,
+                      stats.coefficient_bytes,    stats.type_bytes,
+                      stats.solver_bytes,         stats.result_bytes,
+                      total};
+    for (idx_t i = 0; i < sizeof(counts) / sizeof(counts[0]); i++) {
+      output.SetValue(1 + i, 0, Value::BIGINT((int64_t)counts[i]));
+    }
+    if (!stats.solver_known) {
+      output.SetValue(11, 0, Value(LogicalType::BIGINT));
+      output.SetValue(12, 0, Value(LogicalType::BIGINT));
+    }
+    output.SetValue(status_col, 0, Value("OK"));
+  }
+
+  static unique_ptr<FunctionData>
+  ModelStatsBind(ClientContext &context, TableFunctionBindInput &input,
+                 vector<LogicalType> &return_types, vector<string> &names) {
+    names.emplace_back("model_name");
+    return_types.emplace_back(LogicalType::VARCHAR);
+    for (auto name :
+         {"num_variables", "num_constraints", "num_nonzeros", "num_integer",
+          "variable_key_bytes", "constraint_key_bytes", "objective_bytes",
+          "bound_bytes", "coefficient_bytes", "type_bytes", "solver_bytes",
+          "result_bytes", "total_bytes"}) {
+      names.emplace_back(name);
+      return_types.emplace_back(LogicalType::BIGINT);
+    }
+    names.emplace_back("status");
+    return_types.emplace_back(LogicalType::VARCHAR);
+    return BindModelName(input, "highs_model_stats");
+  }
+
+  static void SolveProfileFunction(ClientContext &context,
+                                   TableFunctionInput &data_p,
+                                   DataChunk &output) {
+    auto &bind_data = data_p.bind_data->Cast<HighsModelStatsData>();
+    auto &global_state = data_p.global_state->Cast<SingleRowGlobalState>();
+    if (global_state.finished) {
+      output.SetCardinality(0);
+      return;
+    }
+    global_state.finished = true;
+
+    auto model_info =
+        HighsModelRegistry::Instance().GetModel(bind_data.model_name);
+    if (!model_info) {
+      output.SetCardinality(1);
+      for (idx_t col = 0; col < output.ColumnCount(); col++) {
+        output.SetValue(col, 0, Value(output.data[col].GetType()));
+      }
+      output.SetValue(2, 0,
+                      Value("ERROR: Model '" + bind_data.model_name +
+                            "' not found"));
+      return;
+    }
+
+    // The log holds fewer entries than fit in one chunk
+    auto entries = model_info->solve_log.Entries();
+    output.SetCardinality(entries.size());
+    for (idx_t row = 0; row < entries.size(); row++) {
+      auto &profile = entries[row];
+      output.SetValue(0, row, Value::BIGINT((int64_t)profile.solve_id));
+      output.SetValue(1, row, Value(profile.source));
+      output.SetValue(2, row,
+                      Value(ModelStatusToString(profile.model_status)));
+      output.SetValue(3, row, Value::DOUBLE(profile.objective_value));
+      output.SetValue(4, row, ProfileTime(profile.assembly_time));
+      output.SetValue(5, row, ProfileTime(profile.pass_model_time));
+      output.SetValue(6, row, ProfileTime(profile.presolve_time));
+      output.SetValue(7, row, ProfileTime(profile.solve_time));
+      output.SetValue(8, row, ProfileTime(profile.emission_time));
+      output.SetValue(9, row, Value::BIGINT(profile.simplex_iterations));
+      output.SetValue(10, row, Value::BIGINT(profile.ipm_iterations));
+      output.SetValue(11, row, Value::BIGINT(profile.crossover_iterations));
+      output.SetValue(12, row, Value::BIGINT(profile.mip_nodes));
+      output.SetValue(13, row, Value::BIGINT(profile.presolve_removed_rows));
+      output.SetValue(14, row,
+                      Value::BIGINT(profile.presolve_removed_columns));
+      output.SetValue(15, row,
+                      profile.mip ? Value::DOUBLE(profile.mip_gap)
+                                  : Value(LogicalType::DOUBLE));
+    }
+  }
+
+  static unique_ptr<FunctionData>
+  SolveProfileBind(ClientContext &context, TableFunctionBindInput &input,
+                   vector<LogicalType> &return_types, vector<string> &names) {
+    names.emplace_back("solve_id");
+    return_types.emplace_back(LogicalType::BIGINT);
+    names.emplace_back("source");
+    return_types.emplace_back(LogicalType::VARCHAR);
+    names.emplace_back("status");
+    return_types.emplace_back(LogicalType::VARCHAR);
+    names.emplace_back("objective_value");
+    return_types.emplace_back(LogicalType::DOUBLE);
+    for (auto name : {"assembly_time", "pass_model_time", "presolve_time",
+                      "solve_time", "emission_time"}) {
+      names.emplace_back(name);
+      return_types.emplace_back(LogicalType::DOUBLE);
+    }
+    for (auto name : {"simplex_iterations", "ipm_iterations",
+                      "crossover_iterations", "mip_nodes",
+                      "presolve_removed_rows", "presolve_removed_columns"}) {
+      names.emplace_back(name);
+      return_types.emplace_back(LogicalType::BIGINT);
+    }
+    names.emplace_back("mip_gap");
+    return_types.emplace_back(LogicalType::DOUBLE);
+    return BindModelName(input, "highs_solve_profile");
+  }
+
+  static unique_ptr<GlobalTableFunctionState>
+  ProfileInit(ClientContext &context, TableFunctionInitInput &input) {
+    return make_uniq<SingleRowGlobalState>();
+  }
+};
+
+struct HighsMemoryRow {
+  std::string model_name;
+  int64_t model_bytes = 0;
+  int64_t solver_bytes = -1; // -1 while the model is being solved
+  double idle_seconds = 0;
+  bool spilled = false;
+};
+
+struct HighsSpillRow {
+  std::string model_name;
+  int64_t released_bytes = 0;
+  std::string status;
+};
+
+struct HighsSpillData : public TableFunctionData {
+  double idle_seconds = 0;
+};
+
+struct HighsMemoryGlobalState : public GlobalTableFunctionState {
+  std::vector<HighsMemoryRow> models;
+  std::vector<HighsSpillRow> spills;
+  idx_t current_row = 0;
+};
+
+// Memory of the registered models: highs_memory() returns one row per model
+// with the bytes it has charged to the buffer pool (see highs_memory.hpp);
+// solver_bytes is NULL while the model is being solved. Their sum is the
+// EXTENSION row of duckdb_memory(). highs_spill_models(idle_seconds) writes
+// every model not used for idle_seconds to the temp directory and frees
+// it; the next query naming a spilled model reads it back.
+struct HighsMemoryFunctions {
+  static void MemoryFunction(ClientContext &context, TableFunctionInput &data_p,
+                             DataChunk &output) {
+    auto &global_state = data_p.global_state->Cast<HighsMemoryGlobalState>();
+    idx_t count = MinValue<idx_t>(
+        global_state.models.size() - global_state.current_row,
+        STANDARD_VECTOR_SIZE);
+    output.SetCardinality(count);
+    for (idx_t i = 0; i < count; i++) {
+      auto &row = global_state.models[global_state.current_row + i];
+      FlatVector::GetData<string_t>(output.data[0])[i] =
+          StringVector::AddString(output.data[0], row.model_name);
+      FlatVector::GetData<int64_t>(output.data[1])[i] = row.model_bytes;
+      if (row.solver_bytes < 0) {
+        FlatVector::SetNull(output.data[2], i, true);
+      } else {
+        FlatVector::GetData<int64_t>(output.data[2])[i] = row.solver_bytes;
+      }
+      FlatVector::GetData<double>(output.data[3])[i] = row.idle_seconds;
+      FlatVector::GetData<bool>(output.data[4])[i] = row.spilled;
+    }
+    global_state.current_row += count;
+  }
+
+  static unique_ptr<FunctionData>
+  MemoryBind(ClientContext &context, TableFunctionBindInput &input,
+             vector<LogicalType> &return_types, vector<string> &names) {
+    names.emplace_back("model_name");
+    return_types.emplace_back(LogicalType::VARCHAR);
+    names.emplace_back("model_bytes");
+    return_types.emplace_back(LogicalType::BIGINT);
+    names.emplace_back("solver_bytes");
+    return_types.emplace_back(LogicalType::BIGINT);
+    names.emplace_back("idle_seconds");
+    return_types.emplace_back(LogicalType::DOUBLE);
+    names.emplace_back("spilled");
+    return_types.emplace_back(LogicalType::BOOLEAN);
+    return make_uniq<TableFunctionData>();
+  }
+
+  static unique_ptr<GlobalTableFunctionState>
+  MemoryInit(ClientContext &context, TableFunctionInitInput &input) {
+    auto result = make_uniq<HighsMemoryGlobalState>();
+    for (auto &entry : HighsModelRegistry::Instance().List()) {
+      auto &model_info = *entry.second;
+      HighsMemoryRow row;
+      row.model_name = entry.first;
+      // Like highs_model_stats, never wait for a running solve
+      std::unique_lock<std::timed_mutex> solver_guard(
+          model_info.solver_mutex, std::try_to_lock);
+      HighsSharedLock guard(model_info.mutex);
+      row.model_bytes = (int64_t)model_info.model_memory.Bytes();
+      if (solver_guard.owns_lock()) {
+        row.solver_bytes = (int64_t)model_info.solver_memory.Bytes();
+      }
+      row.idle_seconds = model_info.IdleSeconds();
+      row.spilled = model_info.spilled;
+      result->models.push_back(std::move(row));
+    }
+    std::sort(result->models.begin(), result->models.end(),
+              [](const HighsMemoryRow &a, const HighsMemoryRow &b) {
+                return a.model_name < b.model_name;
+              });
+    return std::move(result);
+  }
+
+  static void SpillFunction(ClientContext &context, TableFunctionInput &data_p,
+                            DataChunk &output) {
+    auto &global_state = data_p.global_state->Cast<HighsMemoryGlobalState>();
+    idx_t count = MinValue<idx_t>(
+        global_state.spills.size() - global_state.current_row,
+        STANDARD_VECTOR_SIZE);
+    output.SetCardinality(count);
+    for (idx_t i = 0; i < count; i++) {
+      auto &row = global_state.spills[global_state.current_row + i];
+      FlatVector::GetData<string_t>(output.data[0])[i] =
+          StringVector::AddString(output.data[0], row.model_name);
+      FlatVector::GetData<int64_t>(output.data[1])[i] = row.released_bytes;
+      FlatVector::GetData<string_t>(output.data[2])[i] =
+          StringVector::AddString(output.data[2], row.status);
+    }
+    global_state.current_row += count;
+  }
+
+  static unique_ptr<FunctionData>
+  SpillBind(ClientContext &context, TableFunctionBindInput &input,
+            vector<LogicalType> &return_types, vector<string> &names) {
+    if (input.inputs.size() != 1 || input.inputs[0].IsNull()) {
+      throw BinderException(
+          "highs_spill_models expects exactly 1 parameter: idle_seconds");
+    }
+    auto result = make_uniq<HighsSpillData>();
+    result->idle_seconds = input.inputs[0].GetValue<double>();
+
+    names.emplace_back("model_name");
+    return_types.emplace_back(LogicalType::VARCHAR);
+    names.emplace_back("released_bytes");
+    return_types.emplace_back(LogicalType::BIGINT);
+    names.emplace_back("status");
+    return_types.emplace_back(LogicalType::VARCHAR);
+    return std::move(result);
+  }
+
+  // The spilling happens here, once per query
+  static unique_ptr<GlobalTableFunctionState>
+  SpillInit(ClientContext &context, TableFunctionInitInput &input) {
+    auto &bind_data = input.bind_data->Cast<HighsSpillData>();
+    auto directory = DBConfig::GetConfig(context).options.temporary_directory;
+    if (directory.empty()) {
+      throw InvalidInputException(
+          "highs_spill_models needs a temp_directory to spill models to");
+    }
+    auto &fs = FileSystem::GetFileSystem(context);
+
+    auto result = make_uniq<HighsMemoryGlobalState>();
+    auto &spills = result->spills;
+    HighsModelRegistry::Instance().SpillIdleModels(
+        bind_data.idle_seconds,
+        [&](const std::string &model_name, HighsModelInfo &model_info) {
+          // Nothing to gain from spilling an empty model
+          if (model_info.next_var_index == 0 &&
+              model_info.next_constraint_index == 0) {
+            model_info.spilled = false;
+            return;
+          }
+          HighsSpillRow row;
+          row.model_name = model_name;
+          try {
+            row.released_bytes =
+                (int64_t)SpillModel(fs, directory, model_info);
+            row.status = "SPILLED";
+          } catch (const std::exception &e) {
+            model_info.spilled = false;
+            row.status = std::string("ERROR: ") + e.what();
+          }
+          spills.push_back(std::move(row));
+        });
+    std::sort(spills.begin(), spills.end(),
+              [](const HighsSpillRow &a, const HighsSpillRow &b) {
+                return a.model_name < b.model_name;
+              });
+    return std::move(result);
+  }
+};
+
+struct HighsJobData : public TableFunctionData {
+  std::string model_name;
+  int64_t job_id = 0;
+};
+
+struct HighsJobsGlobalState : public GlobalTableFunctionState {
+  std::vector<HighsJobInfo> jobs;
+  idx_t current_row = 0;
+};
+
+struct HighsRangingGlobalState : public GlobalTableFunctionState {
+  unique_ptr<HighsRangingResult> result;
+  idx_t current_row = 0; // columns first, then rows
+  bool finished = false;
+};
+
+// Table function for what-if questions without re-solving:
+// highs_ranging(model_name) returns one row per variable and then one per
+// constraint of an LP, with the range of its cost and of its active bound
+// over which the optimal basis stays optimal, and the objective value at
+// either end of each range. Constraints have no cost range. The ranges
+// come from the basis of the model's last solve, so after a highs_solve
+// this is one cheap pass over the basis. Infinite ends are reported as
+// +/-inf.
+struct HighsRangingFunction {
+  static void RangingFunction(ClientContext &context,
+                              TableFunctionInput &data_p, DataChunk &output) {
+    auto &bind_data = data_p.bind_data->Cast<HighsModelStatsData>();
+    auto &global_state = data_p.global_state->Cast<HighsRangingGlobalState>();
+    if (global_state.finished) {
+      output.SetCardinality(0);
+      return;
+    }
+
+    if (!global_state.result) {
+      std::string error;
+      auto model_info =
+          HighsModelRegistry::Instance().GetModel(bind_data.model_name);
+      if (!model_info) {
+        error = "Model '" + bind_data.model_name + "' not found";
+      } else {
+        HighsRunMonitor monitor;
+        monitor.WatchInterrupt(&context.interrupted);
+        try {
+          global_state.result = make_uniq<HighsRangingResult>(
+              RangeModel(*model_info,
+                         HighsThreadSettings::FromContext(context), &monitor));
+        } catch (const InterruptException &) {
+          throw;
+        } catch (const std::exception &e) {
+          error = e.what();
+        }
+      }
+      if (global_state.result && context.interrupted &&
+          global_state.result->model_status == HighsModelStatus::kInterrupt) {
+        throw InterruptException();
+      }
+      if (global_state.result &&
+          global_state.result->model_status != HighsModelStatus::kOptimal) {
+        error = std::string("Ranging needs an optimal solution; model "
+                            "status is ") +
+                ModelStatusToString(global_state.result->model_status);
+      }
+      if (!error.empty()) {
+        output.SetCardinality(1);
+        for (idx_t col = 0; col < output.ColumnCount(); col++) {
+          output.SetValue(col, 0, Value(output.data[col].GetType()));
+        }
+        output.SetValue(output.ColumnCount() - 1, 0, Value("ERROR: " + error));
+        global_state.finished = true;
+        return;
+      }
+    }
+
+    auto &result = *global_state.result;
+    auto &ranging = result.ranging;
+    idx_t num_rows = result.columns.count + result.rows.count;
+    idx_t count = MinValue<idx_t>(num_rows - global_state.current_row,
+                                  STANDARD_VECTOR_SIZE);
+    output.SetCardinality(count);
+    for (idx_t i = 0; i < count; i++) {
+      idx_t row = global_state.current_row + i;
+      bool is_column = row < result.columns.count;
+      idx_t index = is_column ? row : row - result.columns.count;
+      auto &keys = is_column ? result.columns : result.rows;
+      output.SetValue(0, i, Value(is_column ? "variable" : "constraint"));
+      output.SetValue(1, i,
+                      keys.names.empty()
+                          ? Value(LogicalType::VARCHAR)
+                          : Value(keys.names[index].GetString()));
+      output.SetValue(2, i, Value::BIGINT(keys.Id(index)));
+      output.SetValue(3, i,
+                      Value::DOUBLE(is_column ? result.col_value[index]
+                                              : result.row_value[index]));
+      if (is_column) {
+        output.SetValue(4, i, Value::DOUBLE(ranging.col_cost_dn.value_[index]));
+        output.SetValue(
+            5, i, Value::DOUBLE(ranging.col_cost_dn.objective_[index]));
+        output.SetValue(6, i, Value::DOUBLE(ranging.col_cost_up.value_[index]));
+        output.SetValue(
+            7, i, Value::DOUBLE(ranging.col_cost_up.objective_[index]));
+      } else {
+        for (idx_t col = 4; col < 8; col++) {
+          output.SetValue(col, i, Value(LogicalType::DOUBLE));
+        }
+      }
+      auto &bound_dn = is_column ? ranging.col_bound_dn : ranging.row_bound_dn;
+      auto &bound_up = is_column ? ranging.col_bound_up : ranging.row_bound_up;
+      output.SetValue(8, i, Value::DOUBLE(bound_dn.value_[index]));
+      output.SetValue(9, i, Value::DOUBLE(bound_dn.objective_[index]));
+      output.SetValue(10, i, Value::DOUBLE(bound_up.value_[index]));
+      output.SetValue(11, i, Value::DOUBLE(bound_up.objective_[index]));
+      output.SetValue(12, i, Value("OK"));
+    }
+    global_state.current_row += count;
+    global_state.finished = global_state.current_row == num_rows;
+  }
+
+  static unique_ptr<FunctionData>
+  RangingBind(ClientContext &context, TableFunctionBindInput &input,
+              vector<LogicalType> &return_types, vector<string> &names) {
+    names.emplace_back("kind");
+    return_types.emplace_back(LogicalType::VARCHAR);
+    names.emplace_back("name");
+    return_types.emplace_back(LogicalType::VARCHAR);
+    names.emplace_back("id");
+    return_types.emplace_back(LogicalType::BIGINT);
+    names.emplace_back("value");
+    return_types.emplace_back(LogicalType::DOUBLE);
+    for (auto name : {"cost_lower", "cost_lower_objective", "cost_upper",
+                      "cost_upper_objective", "bound_lower",
+                      "bound_lower_objective", "bound_upper",
+                      "bound_upper_objective"}) {
+      names.emplace_back(name);
+      return_types.emplace_back(LogicalType::DOUBLE);
+    }
+    names.emplace_back("status");
+    return_types.emplace_back(LogicalType::VARCHAR);
+    return BindModelName(input, "highs_ranging");
+  }
+
+  static unique_ptr<GlobalTableFunctionState>
+  RangingInit(ClientContext &context, TableFunctionInitInput &input) {
+    return make_uniq<HighsRangingGlobalState>();
+  }
+};
+
+// Background solves: highs_solve_async(model_name) queues a solve and
+// returns its job id, highs_jobs() lists jobs with their progress,
+// highs_wait(job_id) blocks until a job has ended and returns its final
+// state, highs_cancel(job_id) stops or forgets a job, and
+// highs_job_solution (above) reads a finished job's result.
+struct HighsJobFunctions {
+  static void SolveAsyncFunction(ClientContext &context,
+                                 TableFunctionInput &data_p,
+                                 DataChunk &output) {
+    auto &bind_data = data_p.bind_data->Cast<HighsJobData>();
+    auto &global_state = data_p.global_state->Cast<SingleRowGlobalState>();
+    if (global_state.finished) {
+      output.SetCardinality(0);
+      return;
+    }
+    global_state.finished = true;
+
+    output.SetCardinality(1);
+    FlatVector::GetData<string_t>(output.data[1])[0] =
+        StringVector::AddString(output.data[1], bind_data.model_name);
+    auto model_info =
+        HighsModelRegistry::Instance().GetModel(bind_data.model_name);
+    if (!model_info) {
+      FlatVector::SetNull(output.data[0], 0, true);
+      FlatVector::GetData<string_t>(output.data[2])[0] =
+          StringVector::AddString(output.data[2], "ERROR: Model '" +
+                                                      bind_data.model_name +
+                                                      "' not found");
+      return;
+    }
+    FlatVector::GetData<int64_t>(output.data[0])[0] =
+        HighsJobManager::Instance().Submit(
+            bind_data.model_name, std::move(model_info),
+            HighsThreadSettings::FromContext(context));
+    FlatVector::GetData<string_t>(output.data[2])[0] = StringVector::AddString(
+        output.data[2], JobStateToString(HighsJobState::QUEUED));
+  }
+
+  static unique_ptr<FunctionData>
+  SolveAsyncBind(ClientContext &context, TableFunctionBindInput &input,
+                 vector<LogicalType> &return_types, vector<string> &names) {
+    auto result = make_uniq<HighsJobData>();
+    if (input.inputs.size() != 1) {
+      throw BinderException(
+          "highs_solve_async expects exactly 1 parameter: model_name");
+    }
+    result->model_name = input.inputs[0].GetValue<string>();
+
+    names.emplace_back("job_id");
+    return_types.emplace_back(LogicalType::BIGINT);
+    names.emplace_back("model_name");
+    return_types.emplace_back(LogicalType::VARCHAR);
+    names.emplace_back("status");
+    return_types.emplace_back(LogicalType::VARCHAR);
+    return std::move(result);
+  }
+
+  static void CancelFunction(ClientContext &context, TableFunctionInput &data_p,
+                             DataChunk &output) {
+    auto &bind_data = data_p.bind_data->Cast<HighsJobData>();
+    auto &global_state = data_p.global_state->Cast<SingleRowGlobalState>();
+    if (global_state.finished) {
+      output.SetCardinality(0);
+      return;
+    }
+    global_state.finished = true;
+
+    std::string status;
+    try {
+      switch (HighsJobManager::Instance().Cancel(bind_data.job_id)) {
+      case HighsJobState::QUEUED:
+        status = "CANCELLED";
+        break;
+      case HighsJobState::RUNNING:
+        status = "CANCELLING";
+        break;
+      default:
+        status = "REMOVED";
+        break;
+      }
+    } catch (const std::exception &e) {
+      status = std::string("ERROR: ") + e.what();
+    }
+    output.SetCardinality(1);
+    FlatVector::GetData<int64_t>(output.data[0])[0] = bind_data.job_id;
+    FlatVector::GetData<string_t>(output.data[1])[0] =
+        StringVector::AddString(output.data[1], status);
+  }
+
+  static unique_ptr<FunctionData>
+  CancelBind(ClientContext &context, TableFunctionBindInput &input,
+             vector<LogicalType> &return_types, vector<string> &names) {
+    auto result = make_uniq<HighsJobData>();
+    if (input.inputs.size() != 1 || input.inputs[0].IsNull()) {
+      throw BinderException("highs_cancel expects exactly 1 parameter: job_id");
+    }
+    result->job_id = input.inputs[0].GetValue<int64_t>();
+
+    names.emplace_back("job_id");
+    return_types.emplace_back(LogicalType::BIGINT);
+    names.emplace_back("status");
+    return_types.emplace_back(LogicalType::VARCHAR);
+    return std::move(result);
+  }
+
+  static void WaitFunction(ClientContext &context, TableFunctionInput &data_p,
+                           DataChunk &output) {
+    auto &bind_data = data_p.bind_data->Cast<HighsJobData>();
+    auto &global_state = data_p.global_state->Cast<SingleRowGlobalState>();
+    if (global_state.finished) {
+      output.SetCardinality(0);
+      return;
+    }
+    global_state.finished = true;
+
+    std::string status;
+    try {
+      status = JobStateToString(
+          HighsJobManager::Instance().Wait(bind_data.job_id,
+                                           context.interrupted));
+    } catch (const InterruptException &) {
+      throw;
+    } catch (const std::exception &e) {
+      status = std::string("ERROR: ") + e.what();
+    }
+    output.SetCardinality(1);
+    FlatVector::GetData<int64_t>(output.data[0])[0] = bind_data.job_id;
+    FlatVector::GetData<string_t>(output.data[1])[0] =
+        StringVector::AddString(output.data[1], status);
+  }
+
+  static unique_ptr<FunctionData>
+  WaitBind(ClientContext &context, TableFunctionBindInput &input,
+           vector<LogicalType> &return_types, vector<string> &names) {
+    auto result = make_uniq<HighsJobData>();
+    if (input.inputs.size() != 1 || input.inputs[0].IsNull()) {
+      throw BinderException("highs_wait expects exactly 1 parameter: job_id");
+    }
+    result->job_id = input.inputs[0].GetValue<int64_t>();
+
+    names.emplace_back("job_id");
+    return_types.emplace_back(LogicalType::BIGINT);
+    names.emplace_back("status");
+    return_types.emplace_back(LogicalType::VARCHAR);
+    return std::move(result);
+  }
+
+  static unique_ptr<GlobalTableFunctionState>
+  SingleRowInit(ClientContext &context, TableFunctionInitInput &input) {
+    return make_uniq<SingleRowGlobalState>();
+  }
+
+  static void JobsFunction(ClientContext &context, TableFunctionInput &data_p,
+                           DataChunk &output) {
+    auto &global_state = data_p.global_state->Cast<HighsJobsGlobalState>();
+    idx_t count = MinValue<idx_t>(
+        global_state.jobs.size() - global_state.current_row,
+        STANDARD_VECTOR_SIZE);
+    output.SetCardinality(count);
+    for (idx_t i = 0; i < count; i++) {
+      auto &job = global_state.jobs[global_state.current_row + i];
+      FlatVector::GetData<int64_t>(output.data[0])[i] = job.job_id;
+      FlatVector::GetData<string_t>(output.data[1])[i] =
+          StringVector::AddString(output.data[1], job.model_name);
+      FlatVector::GetData<string_t>(output.data[2])[i] =
+          StringVector::AddString(output.data[2], JobStateToString(job.state));
+      if (job.model_status == HighsModelStatus::kNotset) {
+        FlatVector::SetNull(output.data[3], i, true);
+      } else {
+        FlatVector::GetData<string_t>(output.data[3])[i] =
+            StringVector::AddString(output.data[3],
+                                    ModelStatusToString(job.model_status));
+      }
+      if (std::isnan(job.objective_value)) {
+        FlatVector::SetNull(output.data[4], i, true);
+      } else {
+        FlatVector::GetData<double>(output.data[4])[i] = job.objective_value;
+      }
+      if (std::isnan(job.mip_gap)) {
+        FlatVector::SetNull(output.data[5], i, true);
+      } else {
+        FlatVector::GetData<double>(output.data[5])[i] = job.mip_gap;
+      }
+      FlatVector::GetData<double>(output.data[6])[i] = job.runtime_seconds;
+      if (job.error.empty()) {
+        FlatVector::SetNull(output.data[7], i, true);
+      } else {
+        FlatVector::GetData<string_t>(output.data[7])[i] =
+            StringVector::AddString(output.data[7], job.error);
+      }
+    }
+    global_state.current_row += count;
+  }
+
+  static unique_ptr<FunctionData>
+  JobsBind(ClientContext &context, TableFunctionBindInput &input,
+           vector<LogicalType> &return_types, vector<string> &names) {
+    names.emplace_back("job_id");
+    return_types.emplace_back(LogicalType::BIGINT);
+    names.emplace_back("model_name");
+    return_types.emplace_back(LogicalType::VARCHAR);
+    names.emplace_back("state");
+    return_types.emplace_back(LogicalType::VARCHAR);
+    names.emplace_back("model_status");
+    return_types.emplace_back(LogicalType::VARCHAR);
+    names.emplace_back("objective_value");
+    return_types.emplace_back(LogicalType::DOUBLE);
+    names.emplace_back("mip_gap");
+    return_types.emplace_back(LogicalType::DOUBLE);
+    names.emplace_back("runtime_seconds");
+    return_types.emplace_back(LogicalType::DOUBLE);
+    names.emplace_back("error");
+    return_types.emplace_back(LogicalType::VARCHAR);
+    return make_uniq<TableFunctionData>();
+  }
+
+  static unique_ptr<GlobalTableFunctionState>
+  JobsInit(ClientContext &context, TableFunctionInitInput &input) {
+    auto result = make_uniq<HighsJobsGlobalState>();
+    result->jobs = HighsJobManager::Instance().List();
+    return std::move(result);
+  }
+};
+
+// One batch of highs_solve_incumbents rows: an improved incumbent, or the
+// final solution with the model status
+struct HighsIncumbent {
+  double objective_value;
+  double mip_gap;
+  double elapsed_seconds;
+  std::vector<double> values;
+  HighsModelStatus status = HighsModelStatus::kNotset; // final batch only
+};
+
+struct HighsSolveIncumbentsData : public TableFunctionData {
+  std::string model_name;
+  bool changes_only = false;
+};
+
+// The solve runs on its own thread and hands incumbents over as HiGHS
+// finds them; the scan emits each one while the search goes on. Dropping
+// the scan early (LIMIT) stops the search. If the scan falls behind, only
+// the latest kMaxPendingIncumbents wait to be emitted, or just the latest
+// one with changes_only, whose rows are relative to whatever was emitted
+// last anyway. The final solution is never dropped.
+struct HighsSolveIncumbentsGlobalState : public GlobalTableFunctionState {
+  static constexpr idx_t kMaxPendingIncumbents = 16;
+
+  HighsKeySnapshot columns; // as of the start of the scan
+  HighsRunMonitor monitor;
+  std::thread solver;
+
+  std::mutex mutex;
+  std::condition_variable ready;
+  std::deque<HighsIncumbent> pending; // guarded by mutex
+  bool done = false;                  // guarded by mutex
+  std::string error;                  // guarded by mutex
+
+  // Scan side
+  HighsIncumbent current;
+  std::vector<idx_t> current_columns; // columns of current still to emit
+  idx_t current_row = 0;
+  int64_t incumbent_id = 0;
+  std::vector<double> previous; // last emitted values, for changes_only
+  bool finished = false;
+
+  ~HighsSolveIncumbentsGlobalState() override {
+    monitor.Cancel();
+    if (solver.joinable()) {
+      solver.join();
+    }
+  }
+};
+
+constexpr idx_t HighsSolveIncumbentsGlobalState::kMaxPendingIncumbents;
+
+struct HighsSolveIncumbentsFunction {
+  static void SolveThread(HighsSolveIncumbentsGlobalState *state,
+                          std::shared_ptr<HighsModelInfo> model_info,
+                          HighsThreadSettings settings) {
+    HighsIncumbent final_batch;
+    std::string error;
+    try {
+      auto result = SolveModel(*model_info, settings, &state->monitor);
+      final_batch.objective_value = result->objective_value;
+      final_batch.mip_gap = state->monitor.Gap();
+      final_batch.elapsed_seconds = state->monitor.Elapsed();
+      final_batch.values = result->col_value;
+      final_batch.status = result->model_status;
+    } catch (const InterruptException &) {
+      // Stopped while waiting for another solve of the model; the scan
+      // throws on seeing the interrupted status
+      final_batch.status = HighsModelStatus::kInterrupt;
+    } catch (const std::exception &e) {
+      error = e.what();
+    }
+    {
+      std::lock_guard<std::mutex> guard(state->mutex);
+      if (error.empty()) {
+        state->pending.push_back(std::move(final_batch));
+      } else {
+        state->error = error;
+      }
+      state->done = true;
+    }
+    state->ready.notify_one();
+  }
+
+  // Wait for the next incumbent and pick the columns to emit for it.
+  // Returns false once the solve has finished and everything is out.
+  static bool NextIncumbent(ClientContext &context,
+                            HighsSolveIncumbentsGlobalState &state,
+                            bool changes_only) {
+    std::unique_lock<std::mutex> guard(state.mutex);
+    state.ready.wait(guard, [&state]() {
+      return state.done || !state.pending.empty();
+    });
+    if (state.pending.empty()) {
+      return false;
+    }
+    state.current = std::move(state.pending.front());
+    state.pending.pop_front();
+    guard.unlock();
+
+    if (context.interrupted &&
+        state.current.status == HighsModelStatus::kInterrupt) {
+      throw InterruptException();
+    }
+    state.incumbent_id++;
+    state.current_row = 0;
+    state.current_columns.clear();
+    auto &values = state.current.values;
+    idx_t count = MinValue<idx_t>(values.size(), state.columns.count);
+    for (idx_t col = 0; col < count; col++) {
+      if (!changes_only || col >= state.previous.size() ||
+          state.previous[col] != values[col]) {
+        state.current_columns.push_back(col);
+      }
+    }
+    state.previous = values;
+    return true;
+  }
+
+  // After the last batch: a single error row if the solve failed, else
+  // the end of the scan
+  static void EmitError(DataChunk &output,
+                        HighsSolveIncumbentsGlobalState &state) {
+    std::string error;
+    {
+      std::lock_guard<std::mutex> guard(state.mutex);
+      error = state.error;
+    }
+    if (error.empty()) {
+      output.SetCardinality(0);
+      return;
+    }
+    output.SetCardinality(1);
+    for (idx_t col = 0; col < output.ColumnCount(); col++) {
+      FlatVector::SetNull(output.data[col], 0, true);
+    }
+    FlatVector::Validity(output.data[7]).SetValid(0);
+    FlatVector::GetData<string_t>(output.data[7])[0] =
+        StringVector::AddString(output.data[7], "ERROR: " + error);
+  }
+
+  static void SolveIncumbentsFunction(ClientContext &context,
+                                      TableFunctionInput &data_p,
+                                      DataChunk &output) {
+    auto &bind_data = data_p.bind_data->Cast<HighsSolveIncumbentsData>();
+    auto &state =
+        data_p.global_state->Cast<HighsSolveIncumbentsGlobalState>();
+
+    while (!state.finished &&
+           state.current_row >= state.current_columns.size()) {
+      if (!NextIncumbent(context, state, bind_data.changes_only)) {
+        state.finished = true;
+        EmitError(output, state);
+        return;
+      }
+    }
+    if (state.finished) {
+      output.SetCardinality(0);
+      return;
+    }
+
+    auto &current = state.current;
+    idx_t count = MinValue<idx_t>(
+        state.current_columns.size() - state.current_row,
+        STANDARD_VECTOR_SIZE);
+    output.SetCardinality(count);
+
+    // Per-incumbent values are constant across the batch
+    output.data[0].SetVectorType(VectorType::CONSTANT_VECTOR);
+    ConstantVector::GetData<int64_t>(output.data[0])[0] = state.incumbent_id;
+    output.data[1].SetVectorType(VectorType::CONSTANT_VECTOR);
+    ConstantVector::GetData<double>(output.data[1])[0] =
+        current.objective_value;
+    output.data[2].SetVectorType(VectorType::CONSTANT_VECTOR);
+    if (std::isnan(current.mip_gap)) {
+      ConstantVector::SetNull(output.data[2], true);
+    } else {
+      ConstantVector::GetData<double>(output.data[2])[0] = current.mip_gap;
+    }
+    output.data[3].SetVectorType(VectorType::CONSTANT_VECTOR);
+    ConstantVector::GetData<double>(output.data[3])[0] =
+        current.elapsed_seconds;
+    output.data[7].SetVectorType(VectorType::CONSTANT_VECTOR);
+    ConstantVector::GetData<string_t>(output.data[7])[0] =
+        StringVector::AddString(output.data[7],
+                                current.status == HighsModelStatus::kNotset
+                                    ? "Incumbent"
+                                    : ModelStatusToString(current.status));
+
+    auto &keys = state.columns;
+    bool has_names = !keys.names.empty();
+    if (has_names) {
+      AttachNameArena(output.data[4], keys.name_arena);
+    } else {
+      FlatVector::Validity(output.data[4]).SetAllInvalid(count);
+      FlatVector::Validity(output.data[5]).SetAllInvalid(count);
+    }
+    auto names = FlatVector::GetData<string_t>(output.data[4]);
+    auto indices = FlatVector::GetData<string_t>(output.data[5]);
+    auto values = FlatVector::GetData<double>(output.data[6]);
+    auto column_indices = FlatVector::GetData<int64_t>(output.data[8]);
+    for (idx_t i = 0; i < count; i++) {
+      idx_t col = state.current_columns[state.current_row + i];
+      if (has_names) {
+        names[i] = keys.names[col];
+        indices[i] = FormatIndexedName(output.data[5], names[i], col);
+      }
+      values[i] = current.values[col];
+      column_indices[i] = (int64_t)col;
+    }
+    state.current_row += count;
+  }
+
+  static unique_ptr<FunctionData>
+  SolveIncumbentsBind(ClientContext &context, TableFunctionBindInput &input,
+                      vector<LogicalType> &return_types,
+                      vector<string> &names) {
+    auto result = make_uniq<HighsSolveIncumbentsData>();
+    if (input.inputs.size() != 1) {
+      throw BinderException(
+          "highs_solve_incumbents expects exactly 1 parameter: model_name");
+    }
+    result->model_name = input.inputs[0].GetValue<string>();
+    auto it = input.named_parameters.find("changes_only");
+    if (it != input.named_parameters.end() && !it->second.IsNull()) {
+      result->changes_only = it->second.GetValue<bool>();
+    }
+
+    names.emplace_back("incumbent_id");
+    return_types.emplace_back(LogicalType::BIGINT);
+    names.emplace_back("objective_value");
+    return_types.emplace_back(LogicalType::DOUBLE);
+    names.emplace_back("mip_gap");
+    return_types.emplace_back(LogicalType::DOUBLE);
+    names.emplace_back("elapsed_seconds");
+    return_types.emplace_back(LogicalType::DOUBLE);
+    names.emplace_back("variable_name");
+    return_types.emplace_back(LogicalType::VARCHAR);
+    names.emplace_back("variable_index");
+    return_types.emplace_back(LogicalType::VARCHAR);
+    names.emplace_back("solution_value");
+    return_types.emplace_back(LogicalType::DOUBLE);
+    names.emplace_back("status");
+    return_types.emplace_back(LogicalType::VARCHAR);
+    names.emplace_back("column_index");
+    return_types.emplace_back(LogicalType::BIGINT);
+    return std::move(result);
+  }
+
+  static unique_ptr<GlobalTableFunctionState>
+  SolveIncumbentsInit(ClientContext &context, TableFunctionInitInput &input) {
+    auto &bind_data = input.bind_data->Cast<HighsSolveIncumbentsData>();
+    auto result = make_uniq<HighsSolveIncumbentsGlobalState>();
+    auto model_info =
+        HighsModelRegistry::Instance().GetModel(bind_data.model_name);
+    if (!model_info) {
+      result->error = "Model '" + bind_data.model_name + "' not found";
+      result->done = true;
+      return std::move(result);
+    }
+    {
+      HighsSharedLock guard(model_info->mutex);
+      result->columns.SnapshotColumns(*model_info);
+    }
+
+    auto *state = result.get();
+    bool changes_only = bind_data.changes_only;
+    state->monitor.WatchInterrupt(&context.interrupted);
+    state->monitor.ListenForSolutions(
+        [state, changes_only](double objective, double gap, double elapsed,
+                              std::vector<double> values) {
+          HighsIncumbent incumbent;
+          incumbent.objective_value = objective;
+          incumbent.mip_gap = gap;
+          incumbent.elapsed_seconds = elapsed;
+          incumbent.values = std::move(values);
+          {
+            std::lock_guard<std::mutex> guard(state->mutex);
+            if (changes_only) {
+              state->pending.clear();
+            } else if (state->pending.size() >=
+                       HighsSolveIncumbentsGlobalState::kMaxPendingIncumbents) {
+              state->pending.pop_front();
+            }
+            state->pending.push_back(std::move(incumbent));
+          }
+          state->ready.notify_one();
+        });
+    state->solver =
+        std::thread(SolveThread, state, std::move(model_info),
+                    HighsThreadSettings::FromContext(context));
+    return std::move(result);
+  }
+};
+
+struct HighsSolveTablesData : public TableFunctionData {
+  std::string variables_query;
+  std::string constraints_query;
+  std::string coefficients_query;
+};
+
+// Stream the result of a query issued on a separate connection, one chunk at
+// a time, cast to the given column types. The connection has its own
+// transaction and settings: the caller's temporary tables, uncommitted
+// changes and search_path are invisible to the query.
+template <class FUNC>
+static void ScanQuery(ClientContext &context, Connection &con,
+                      const std::string &query,
+                      const vector<LogicalType> &types, const char *what,
+                      FUNC &&func) {
+  auto result = con.SendQuery(query);
+  if (result->HasError()) {
+    throw std::runtime_error(std::string(what) +
+                             " query failed: " + result->GetError());
+  }
+  if (result->types.size() != types.size()) {
+    throw std::runtime_error(std::string(what) +
+                             " query must return exactly " +
+                             std::to_string(types.size()) + " columns");
+  }
+  DataChunk cast_chunk;
+  cast_chunk.Initialize(Allocator::Get(context), types);
+  while (true) {
+    auto chunk = result->Fetch();
+    if (!chunk || chunk->size() == 0) {
+      break;
+    }
+    CastInputChunk(context, *chunk, cast_chunk);
+    func(cast_chunk);
+  }
+  if (result->HasError()) {
+    throw std::runtime_error(std::string(what) +
+                             " query failed: " + result->GetError());
+  }
+}
+
+// Bind a query given as a string on a connection like the one it will run
+// on, so a query naming something that connection cannot see fails the
+// statement with the reason instead of with a bare catalog error
+static void CheckSideQuery(ClientContext &context, const char *function,
+                           const char *what, const std::string &query,
+                           idx_t num_columns) {
+  Connection con(*context.db);
+  auto prepared = con.Prepare(query);
+  if (prepared->HasError()) {
+    std::string error = prepared->GetError();
+    if (StringUtil::StartsWith(error, "Catalog Error")) {
+      throw BinderException(
+          std::string(function) + ": the " + what +
+          " query names a table or view that does not resolve. It runs on "
+          "a separate connection, which does not see this session's "
+          "temporary tables, uncommitted changes or search_path; query "
+          "committed tables, qualified by schema if needed. " +
+          error);
+    }
+    throw BinderException(std::string(function) + ": " + what +
+                          " query failed: " + error);
+  }
+  if (prepared->ColumnCount() != num_columns) {
+    throw BinderException(std::string(function) + ": " + what +
+                          " query must return exactly " +
+                          std::to_string(num_columns) + " columns");
+  }
+}
+
+// Table function building an LP straight from three relations:
+// highs_solve_tables(variables_query, constraints_query, coefficients_query)
+// with the queries returning (variable_name, lower_bound, upper_bound,
+// obj_coefficient, var_type), (constraint_name, lower_bound, upper_bound)
+// and (constraint_name, variable_name, coefficient). Nothing goes through
+// the model registry; names are hash-joined to dense indices and the matrix
+// is assembled from the coefficient triplets.
+//
+// The queries run on a separate connection, so they do not see the
+// caller's temporary tables, uncommitted rows or search_path (see
+// docs/README.md). They are bound there when the call is, so a name that
+// does not resolve fails the statement with that explanation. Session-local
+// data has to go through the table-in/out loaders instead.
+struct HighsSolveTablesFunction {
+  static std::shared_ptr<const HighsSolveResult>
+  BuildAndSolve(ClientContext &context, const HighsSolveTablesData &bind_data,
+                HighsRunMonitor &monitor) {
+    Connection con(*context.db);
+    HighsLp lp;
+    lp.sense_ = ObjSense::kMinimize;
+
+    // Build side of the join: variable and constraint names
+    HighsNameTable variable_names;
+    std::vector<HighsVariableType> variable_types;
+    ScanQuery(
+        context, con, bind_data.variables_query,
+        {LogicalType::VARCHAR, LogicalType::DOUBLE, LogicalType::DOUBLE,
+         LogicalType::DOUBLE, LogicalType::VARCHAR},
+        "variables", [&](DataChunk &chunk) {
+          idx_t count = chunk.size();
+          UnifiedVectorFormat formats[5];
+          for (idx_t col = 0; col < 5; col++) {
+            chunk.data[col].ToUnifiedFormat(count, formats[col]);
+          }
+          auto names = UnifiedVectorFormat::GetData<string_t>(formats[0]);
+          auto lower_bounds = UnifiedVectorFormat::GetData<double>(formats[1]);
+          auto upper_bounds = UnifiedVectorFormat::GetData<double>(formats[2]);
+          auto costs = UnifiedVectorFormat::GetData<double>(formats[3]);
+          auto types = UnifiedVectorFormat::GetData<string_t>(formats[4]);
+
+          for (idx_t row = 0; row < count; row++) {
+            idx_t idx[5];
+            for (idx_t col = 0; col < 5; col++) {
+              idx[col] = formats[col].sel->get_index(row);
+            }
+            if (!formats[0].validity.RowIsValid(idx[0])) {
+              throw std::runtime_error(
+                  "variables query returned a NULL variable_name");
+            }
+            if (variable_names.Insert(names[idx[0]]) < 0) {
+              throw std::runtime_error("Duplicate variable '" +
+                                       names[idx[0]].GetString() + "'");
+            }
+            lp.col_lower_.push_back(formats[1].validity.RowIsValid(idx[1])
+                                        ? lower_bounds[idx[1]]
+                                        : 0.0);
+            lp.col_upper_.push_back(formats[2].validity.RowIsValid(idx[2])
+                                        ? upper_bounds[idx[2]]
+                                        : kHighsInf);
+            lp.col_cost_.push_back(
+                formats[3].validity.RowIsValid(idx[3]) ? costs[idx[3]] : 0.0);
+            variable_types.push_back(formats[4].validity.RowIsValid(idx[4])
+                                         ? ParseVariableType(types[idx[4]])
+                                         : HighsVariableType::CONTINUOUS);
+          }
+        });
+
+    HighsNameTable constraint_names;
+    ScanQuery(
+        context, con, bind_data.constraints_query,
+        {LogicalType::VARCHAR, LogicalType::DOUBLE, LogicalType::DOUBLE},
+        "constraints", [&](DataChunk &chunk) {
+          idx_t count = chunk.size();
+          UnifiedVectorFormat formats[3];
+          for (idx_t col = 0; col < 3; col++) {
+            chunk.data[col].ToUnifiedFormat(count, formats[col]);
+          }
+          auto names = UnifiedVectorFormat::GetData<string_t>(formats[0]);
+          auto lower_bounds = UnifiedVectorFormat::GetData<double>(formats[1]);
+          auto upper_bounds = UnifiedVectorFormat::GetData<double>(formats[2]);
+
+          for (idx_t row = 0; row < count; row++) {
+            auto name_idx = formats[0].sel->get_index(row);
+            auto lower_idx = formats[1].sel->get_index(row);
+            auto upper_idx = formats[2].sel->get_index(row);
+            if (!formats[0].validity.RowIsValid(name_idx)) {
+              throw std::runtime_error(
+                  "constraints query returned a NULL constraint_name");
+            }
+            if (constraint_names.Insert(names[name_idx]) < 0) {
+              throw std::runtime_error("Duplicate constraint '" +
+                                       names[name_idx].GetString() + "'");
+            }
+            lp.row_lower_.push_back(formats[1].validity.RowIsValid(lower_idx)
+                                        ? lower_bounds[lower_idx]
+                                        : -kHighsInf);
+            lp.row_upper_.push_back(formats[2].validity.RowIsValid(upper_idx)
+                                        ? upper_bounds[upper_idx]
+                                        : kHighsInf);
+          }
+        });
+
+    // Probe side: resolve coefficient names to (row, col) triplets
+    std::vector<int> rows;
+    std::vector<int> cols;
+    std::vector<double> values;
+    ScanQuery(
+        context, con, bind_data.coefficients_query,
+        {LogicalType::VARCHAR, LogicalType::VARCHAR, LogicalType::DOUBLE},
+        "coefficients", [&](DataChunk &chunk) {
+          idx_t count = chunk.size();
+          UnifiedVectorFormat formats[3];
+          for (idx_t col = 0; col < 3; col++) {
+            chunk.data[col].ToUnifiedFormat(count, formats[col]);
+          }
+          auto constraint_names_in =
+              UnifiedVectorFormat::GetData<string_t>(formats[0]);
+          auto variable_names_in =
+              UnifiedVectorFormat::GetData<string_t>(formats[1]);
+          auto coefficients = UnifiedVectorFormat::GetData<double>(formats[2]);
+
+          ReserveGrown(rows, rows.size() + count);
+          ReserveGrown(cols, cols.size() + count);
+          ReserveGrown(values, values.size() + count);
+          for (idx_t row = 0; row < count; row++) {
+            auto constraint_idx = formats[0].sel->get_index(row);
+            auto variable_idx = formats[1].sel->get_index(row);
+            auto coefficient_idx = formats[2].sel->get_index(row);
+            if (!formats[0].validity.RowIsValid(constraint_idx) ||
+                !formats[1].validity.RowIsValid(variable_idx) ||
+                !formats[2].validity.RowIsValid(coefficient_idx)) {
+              throw std::runtime_error(
+                  "coefficients query returned a NULL value");
+            }
+            const string_t &constraint_name =
+                constraint_names_in[constraint_idx];
+            int constraint_index = constraint_names.Find(constraint_name);
+            if (constraint_index < 0) {
+              throw std::runtime_error("Constraint '" +
+                                       constraint_name.GetString() +
+                                       "' not found");
+            }
+            const string_t &variable_name = variable_names_in[variable_idx];
+            int var_index = variable_names.Find(variable_name);
+            if (var_index < 0) {
+              throw std::runtime_error("Variable '" +
+                                       variable_name.GetString() +
+                                       "' not found");
+            }
+            rows.push_back(constraint_index);
+            cols.push_back(var_index);
+            values.push_back(coefficients[coefficient_idx]);
+          }
+        });
+    auto result = std::make_shared<HighsSolveResult>();
+    result->columns.SnapshotNames(variable_names);
+    result->rows.SnapshotNames(constraint_names);
+
+    lp.num_col_ = (HighsInt)variable_names.Size();
+    lp.num_row_ = (HighsInt)lp.row_lower_.size();
+
+    HighsColwiseMatrix matrix;
+    AssembleColwiseMatrix(lp.num_col_, rows.data(), cols.data(),
+                          values.data(), rows.size(), matrix,
+                          HighsSolveWidth(HighsThreadSettings::FromContext(
+                                              context),
+                                          HighsOptionProfile()));
+    rows = std::vector<int>();
+    cols = std::vector<int>();
+    values = std::vector<double>();
+
+    lp.a_matrix_.format_ = MatrixFormat::kColwise;
+    lp.a_matrix_.num_col_ = lp.num_col_;
+    lp.a_matrix_.num_row_ = lp.num_row_;
+    lp.a_matrix_.start_ = std::move(matrix.start);
+    lp.a_matrix_.index_ = std::move(matrix.index);
+    lp.a_matrix_.value_ = std::move(matrix.value);
+    SetIntegrality(variable_types, lp);
+
+    Highs highs;
+    if (highs.passModel(std::move(lp)) != HighsStatus::kOk) {
+      throw std::runtime_error("Failed to pass model to HiGHS");
+    }
+    HighsSolveSlot slot(context, highs, HighsOptionProfile());
+    monitor.Start(result->columns.count, result->rows.count,
+                  highs.getOptions().time_limit);
+    HighsMonitorScope scope(highs, monitor);
+    RunHighs(highs, *result);
+    return std::move(result);
+  }
+
+  static void SolveTablesFunction(ClientContext &context,
+                                  TableFunctionInput &data_p,
+                                  DataChunk &output) {
+    auto &bind_data = data_p.bind_data->Cast<HighsSolveTablesData>();
+    auto &global_state = data_p.global_state->Cast<HighsSolveGlobalState>();
+
+    if (global_state.finished) {
+      output.SetCardinality(0);
+      return;
+    }
+
+    if (!global_state.result) {
+      global_state.monitor.WatchInterrupt(&context.interrupted);
+      try {
+        global_state.result =
+            BuildAndSolve(context, bind_data, global_state.monitor);
+      } catch (const std::exception &e) {
+        SetSolveErrorRow(output, global_state.projection, e.what());
+        global_state.finished = true;
+        return;
+      }
+      CheckInterrupted(context, *global_state.result);
+    }
+
+    EmitSolutionBatch(output, global_state);
+  }
+
+  static unique_ptr<FunctionData>
+  SolveTablesBind(ClientContext &context, TableFunctionBindInput &input,
+                  vector<LogicalType> &return_types, vector<string> &names) {
+    auto result = make_uniq<HighsSolveTablesData>();
+
+    if (input.inputs.size() != 3) {
+      throw BinderException(
+          "highs_solve_tables expects exactly 3 parameters: variables_query, "
+          "constraints_query, coefficients_query");
+    }
+
+    result->variables_query = input.inputs[0].GetValue<string>();
+    result->constraints_query = input.inputs[1].GetValue<string>();
+    result->coefficients_query = input.inputs[2].GetValue<string>();
+    CheckSideQuery(context, "highs_solve_tables", "variables",
+                   result->variables_query, 5);
+    CheckSideQuery(context, "highs_solve_tables", "constraints",
+                   result->constraints_query, 3);
+    CheckSideQuery(context, "highs_solve_tables", "coefficients",
+                   result->coefficients_query, 3);
+
+    // Define output schema
+    SetSolveSchema(SolveSchema(HighsSolveOutput::VARIABLES), return_types,
+                   names);
+
+    return std::move(result);
+  }
+
+  static unique_ptr<GlobalTableFunctionState>
+  SolveTablesInit(ClientContext &context, TableFunctionInitInput &input) {
+    auto result = make_uniq<HighsSolveGlobalState>();
+    result->projection.Initialize(context, input,
+                                  SolveSchema(HighsSolveOutput::VARIABLES));
+    return std::move(result);
+  }
+};
+
+// One input row of highs_solve_agg, kept until the group is finalized
+struct HighsAggEntry {
+  enum class Kind : uint8_t { VARIABLE, CONSTRAINT, COEFFICIENT };
+  Kind kind;
+  std::string variable_name;
+  std::string constraint_name;
+  // NaN where the input was NULL
+  double coefficient;
+  double lower_bound;
+  double upper_bound;
+  double obj_coefficient;
+};
+
+// Aggregate state: a pointer, so DuckDB can move states around freely
+struct HighsSolveAggState {
+  std::vector<HighsAggEntry> *entries;
+};
+
+struct HighsSolveAggBindData : public FunctionData {
+  HighsThreadSettings settings;
+
+  unique_ptr<FunctionData> Copy() const override {
+    return make_uniq<HighsSolveAggBindData>(*this);
+  }
+
+  bool Equals(const FunctionData &other_p) const override {
+    auto &other = other_p.Cast<HighsSolveAggBindData>();
+    return settings.mode == other.settings.mode &&
+           settings.duckdb_threads == other.settings.duckdb_threads;
+  }
+};
+
+// Aggregate solving one small LP per group:
+// highs_solve_agg(variable_name, constraint_name, coefficient, lower_bound,
+// upper_bound, obj_coefficient). A row with only a variable_name declares a
+// variable (bounds default to [0, inf), cost to 0); one with only a
+// constraint_name declares a constraint (bounds default to free); one with
+// both is a coefficient, and its bounds and cost are ignored. Variables and
+// constraints that only appear in coefficients take the defaults, and
+// duplicate coefficients are summed. The model is minimised.
+//
+// Groups are collected by DuckDB's parallel hash aggregate and solved when
+// it finalizes them, which it does for many partitions at once; each solve
+// is admitted as one of duckdb_threads side by side. The result is a STRUCT
+// of the status and objective value as highs_solve reports them, and the
+// variables' values sorted by name. A group that cannot be solved gets an
+// 'ERROR: ...' status and NULL values; one without any rows naming a
+// variable or constraint is NULL.
+struct HighsSolveAggFunction {
+  template <class STATE> static void Initialize(STATE &state) {
+    state.entries = nullptr;
+  }
+
+  template <class STATE>
+  static void Destroy(STATE &state, AggregateInputData &aggr_input_data) {
+    delete state.entries;
+    state.entries = nullptr;
+  }
+
+  static LogicalType ReturnType() {
+    child_list_t<LogicalType> variable_fields;
+    variable_fields.emplace_back("variable_name", LogicalType::VARCHAR);
+    variable_fields.emplace_back("solution_value", LogicalType::DOUBLE);
+    variable_fields.emplace_back("reduced_cost", LogicalType::DOUBLE);
+    child_list_t<LogicalType> fields;
+    fields.emplace_back("status", LogicalType::VARCHAR);
+    fields.emplace_back("objective_value", LogicalType::DOUBLE);
+    fields.emplace_back("variables", LogicalType::LIST(LogicalType::STRUCT(
+                                         std::move(variable_fields))));
+    return LogicalType::STRUCT(std::move(fields));
+  }
+
+  // Add the input rows to the state get_state(row) returns
+  template <class GET_STATE>
+  static void AddRows(Vector inputs[], idx_t count, GET_STATE &&get_state) {
+    UnifiedVectorFormat formats[6];
+    for (idx_t col = 0; col < 6; col++) {
+      inputs[col].ToUnifiedFormat(count, formats[col]);
+    }
+    auto variable_names = UnifiedVectorFormat::GetData<string_t>(formats[0]);
+    auto constraint_names =
+        UnifiedVectorFormat::GetData<string_t>(formats[1]);
+    const double *values[4];
+    for (idx_t col = 2; col < 6; col++) {
+      values[col - 2] = UnifiedVectorFormat::GetData<double>(formats[col]);
+    }
+
+    for (idx_t row = 0; row < count; row++) {
+      auto variable_idx = formats[0].sel->get_index(row);
+      auto constraint_idx = formats[1].sel->get_index(row);
+      bool has_variable = formats[0].validity.RowIsValid(variable_idx);
+      bool has_constraint = formats[1].validity.RowIsValid(constraint_idx);
+      if (!has_variable && !has_constraint) {
+        continue;
+      }
+      HighsAggEntry entry;
+      entry.kind = !has_constraint ? HighsAggEntry::Kind::VARIABLE
+                   : !has_variable ? HighsAggEntry::Kind::CONSTRAINT
+                                   : HighsAggEntry::Kind::COEFFICIENT;
+      if (has_variable) {
+        entry.variable_name = variable_names[variable_idx].GetString();
+      }
+      if (has_constraint) {
+        entry.constraint_name = constraint_names[constraint_idx].GetString();
+      }
+      double *fields[4] = {&entry.coefficient, &entry.lower_bound,
+                           &entry.upper_bound, &entry.obj_coefficient};
+      for (idx_t i = 0; i < 4; i++) {
+        auto idx = formats[i + 2].sel->get_index(row);
+        *fields[i] = formats[i + 2].validity.RowIsValid(idx)
+                         ? values[i][idx]
+                         : std::numeric_limits<double>::quiet_NaN();
+      }
+      if (entry.kind == HighsAggEntry::Kind::COEFFICIENT &&
+          std::isnan(entry.coefficient)) {
+        continue;
+      }
+
+      HighsSolveAggState &state = get_state(row);
+      if (!state.entries) {
+        state.entries = new std::vector<HighsAggEntry>();
+      }
+      state.entries->push_back(std::move(entry));
+    }
+  }
+
+  static void Update(Vector inputs[], AggregateInputData &aggr_input_data,
+                     idx_t input_count, Vector &state_vector, idx_t count) {
+    UnifiedVectorFormat state_format;
+    state_vector.ToUnifiedFormat(count, state_format);
+    auto states =
+        UnifiedVectorFormat::GetData<HighsSolveAggState *>(state_format);
+    AddRows(inputs, count, [&](idx_t row) -> HighsSolveAggState & {
+      return *states[state_format.sel->get_index(row)];
+    });
+  }
+
+  static void SimpleUpdate(Vector inputs[],
+                           AggregateInputData &aggr_input_data,
+                           idx_t input_count, data_ptr_t state, idx_t count) {
+    auto &single = *reinterpret_cast<HighsSolveAggState *>(state);
+    AddRows(inputs, count,
+            [&](idx_t) -> HighsSolveAggState & { return single; });
+  }
+
+  static void Combine(Vector &source_vector, Vector &target_vector,
+                      AggregateInputData &aggr_input_data, idx_t count) {
+    auto sources = FlatVector::GetData<HighsSolveAggState *>(source_vector);
+    auto targets = FlatVector::GetData<HighsSolveAggState *>(target_vector);
+    bool destructive = aggr_input_data.combine_type ==
+                       AggregateCombineType::ALLOW_DESTRUCTIVE;
+    for (idx_t i = 0; i < count; i++) {
+      auto &source = *sources[i];
+      auto &target = *targets[i];
+      if (!source.entries) {
+        continue;
+      }
+      if (!target.entries) {
+        if (destructive) {
+          std::swap(target.entries, source.entries);
+        } else {
+          target.entries = new std::vector<HighsAggEntry>(*source.entries);
+        }
+        continue;
+      }
+      if (destructive) {
+        target.entries->insert(
+            target.entries->end(),
+            std::make_move_iterator(source.entries->begin()),
+            std::make_move_iterator(source.entries->end()));
+      } else {
+        target.entries->insert(target.entries->end(),
+                               source.entries->begin(),
+                               source.entries->end());
+      }
+    }
+  }
+
+  // The group's solution: its status, objective and the values of its
+  // variables in name order. Throws if the group does not make a model.
+  struct GroupSolution {
+    HighsSolveResult result;
+    std::vector<std::pair<std::string, int>> variables;
+  };
+
+  static void SolveGroup(const std::vector<HighsAggEntry> &entries,
+                         const HighsThreadSettings &settings,
+                         GroupSolution &solution) {
+    HighsLp lp;
+    lp.sense_ = ObjSense::kMinimize;
+    HighsNameTable variable_names;
+    HighsNameTable constraint_names;
+    std::vector<bool> variable_declared;
+    std::vector<bool> constraint_declared;
+    auto or_default = [](double value, double fallback) {
+      return std::isnan(value) ? fallback : value;
+    };
+
+    auto add_variable = [&](const std::string &name) -> int {
+      int index = variable_names.Insert(name);
+      if (index >= 0) {
+        lp.col_lower_.push_back(0.0);
+        lp.col_upper_.push_back(kHighsInf);
+        lp.col_cost_.push_back(0.0);
+        variable_declared.push_back(false);
+        solution.variables.emplace_back(name, index);
+      }
+      return index >= 0 ? index : variable_names.Find(name);
+    };
+    auto add_constraint = [&](const std::string &name) -> int {
+      int index = constraint_names.Insert(name);
+      if (index >= 0) {
+        lp.row_lower_.push_back(-kHighsInf);
+        lp.row_upper_.push_back(kHighsInf);
+        constraint_declared.push_back(false);
+      }
+      return index >= 0 ? index : constraint_names.Find(name);
+    };
+    // Declarations first, as rows arrive in no particular order
+    for (auto &entry : entries) {
+      if (entry.kind == HighsAggEntry::Kind::VARIABLE) {
+        int col = add_variable(entry.variable_name);
+        if (variable_declared[col]) {
+          throw std::runtime_error("Duplicate variable '" +
+                                   entry.variable_name + "'");
+        }
+        variable_declared[col] = true;
+        lp.col_lower_[col] = or_default(entry.lower_bound, 0.0);
+        lp.col_upper_[col] = or_default(entry.upper_bound, kHighsInf);
+        lp.col_cost_[col] = or_default(entry.obj_coefficient, 0.0);
+      } else if (entry.kind == HighsAggEntry::Kind::CONSTRAINT) {
+        int row = add_constraint(entry.constraint_name);
+        if (constraint_declared[row]) {
+          throw std::runtime_error("Duplicate constraint '" +
+                                   entry.constraint_name + "'");
+        }
+        constraint_declared[row] = true;
+        lp.row_lower_[row] = or_default(entry.lower_bound, -kHighsInf);
+        lp.row_upper_[row] = or_default(entry.upper_bound, kHighsInf);
+      }
+    }
+    std::vector<int> rows;
+    std::vector<int> cols;
+    std::vector<double> values;
+    for (auto &entry : entries) {
+      if (entry.kind == HighsAggEntry::Kind::COEFFICIENT) {
+        cols.push_back(add_variable(entry.variable_name));
+        rows.push_back(add_constraint(entry.constraint_name));
+        values.push_back(entry.coefficient);
+      }
+    }
+
+    lp.num_col_ = (HighsInt)variable_names.Size();
+    lp.num_row_ = (HighsInt)constraint_names.Size();
+    HighsColwiseMatrix matrix;
+    AssembleColwiseMatrix(lp.num_col_, rows.data(), cols.data(),
+                          values.data(), values.size(), matrix);
+    lp.a_matrix_.format_ = MatrixFormat::kColwise;
+    lp.a_matrix_.num_col_ = lp.num_col_;
+    lp.a_matrix_.num_row_ = lp.num_row_;
+    lp.a_matrix_.start_ = std::move(matrix.start);
+    lp.a_matrix_.index_ = std::move(matrix.index);
+    lp.a_matrix_.value_ = std::move(matrix.value);
+
+    auto &result = solution.result;
+    result.columns.count = variable_names.Size();
+    result.rows.count = constraint_names.Size();
+    Highs highs;
+    // Thousands of group solves would flood the log
+    highs.setOptionValue("output_flag", false);
+    if (highs.passModel(std::move(lp)) != HighsStatus::kOk) {
+      throw std::runtime_error("Failed to pass model to HiGHS");
+    }
+    HighsSolveSlot slot(settings, highs, HighsOptionProfile(),
+                        settings.duckdb_threads);
+    RunHighs(highs, result);
+
+    std::sort(solution.variables.begin(), solution.variables.end());
+  }
+
+  static void Finalize(Vector &state_vector,
+                       AggregateInputData &aggr_input_data, Vector &result,
+                       idx_t count, idx_t offset) {
+    auto &settings =
+        aggr_input_data.bind_data->Cast<HighsSolveAggBindData>().settings;
+    UnifiedVectorFormat state_format;
+    state_vector.ToUnifiedFormat(count, state_format);
+    auto states =
+        UnifiedVectorFormat::GetData<HighsSolveAggState *>(state_format);
+
+    auto &fields = StructVector::GetEntries(result);
+    auto &status_vector = *fields[0];
+    auto &objective_vector = *fields[1];
+    auto &list_vector = *fields[2];
+    auto list_entries = FlatVector::GetData<list_entry_t>(list_vector);
+    for (idx_t i = 0; i < count; i++) {
+      auto &state = *states[state_format.sel->get_index(i)];
+      idx_t row = i + offset;
+      // Like other aggregates, NULL when there was nothing to aggregate
+      if (!state.entries) {
+        FlatVector::SetNull(result, row, true);
+        continue;
+      }
+      GroupSolution solution;
+      std::string status;
+      try {
+        SolveGroup(*state.entries, settings, solution);
+        status = ModelStatusToString(solution.result.model_status);
+      } catch (const std::exception &e) {
+        status = std::string("ERROR: ") + e.what();
+        FlatVector::GetData<string_t>(status_vector)[row] =
+            StringVector::AddString(status_vector, status);
+        FlatVector::SetNull(objective_vector, row, true);
+        FlatVector::SetNull(list_vector, row, true);
+        continue;
+      }
+
+      auto &group = solution.result;
+      FlatVector::GetData<string_t>(status_vector)[row] =
+          StringVector::AddString(status_vector, status);
+      FlatVector::GetData<double>(objective_vector)[row] =
+          group.objective_value;
+
+      idx_t list_offset = ListVector::GetListSize(list_vector);
+      idx_t num_variables = solution.variables.size();
+      ListVector::Reserve(list_vector, list_offset + num_variables);
+      auto &variable_fields =
+          StructVector::GetEntries(ListVector::GetEntry(list_vector));
+      auto names = FlatVector::GetData<string_t>(*variable_fields[0]);
+      auto values = FlatVector::GetData<double>(*variable_fields[1]);
+      auto duals = FlatVector::GetData<double>(*variable_fields[2]);
+      for (idx_t k = 0; k < num_variables; k++) {
+        auto &variable = solution.variables[k];
+        names[list_offset + k] =
+            StringVector::AddString(*variable_fields[0], variable.first);
+        values[list_offset + k] = group.col_value[variable.second];
+        duals[list_offset + k] = group.col_dual[variable.second];
+      }
+      ListVector::SetListSize(list_vector, list_offset + num_variables);
+      list_entries[row].offset = list_offset;
+      list_entries[row].length = num_variables;
+    }
+  }
+
+  static unique_ptr<FunctionData>
+  Bind(ClientContext &context, AggregateFunction &function,
+       vector<unique_ptr<Expression>> &arguments) {
+    auto result = make_uniq<HighsSolveAggBindData>();
+    result->settings = HighsThreadSettings::FromContext(context);
+    return std::move(result);
+  }
+};
+
+// One override of a scenario: a bound or cost replacing the base value
+struct HighsScenarioOverride {
+  enum class Target : uint8_t {
+    COL_LOWER,
+    COL_UPPER,
+    COL_COST,
+    ROW_LOWER,
+    ROW_UPPER
+  };
+  Target target;
+  int index;
+  double value;
+};
+
+struct HighsScenario {
+  int64_t scenario_id;
+  std::vector<HighsScenarioOverride> overrides;
+};
+
+struct HighsSolveScenariosData : public TableFunctionData {
+  std::string model_name;
+  std::string scenario_query;
+};
+
+// The base LP and names are assembled once and shared read-only by all
+// worker threads; scenarios are handed out one at a time
+struct HighsSolveScenariosGlobalState : public GlobalTableFunctionState {
+  std::shared_ptr<const HighsLp> base_lp;
+  HighsKeySnapshot columns;
+  std::vector<HighsScenario> scenarios;
+  HighsOptionProfile options;
+  std::atomic<idx_t> next_scenario{0};
+  idx_t max_threads = 1;
+  std::string error;
+  std::atomic<bool> error_emitted{false};
+
+  idx_t MaxThreads() const override { return max_threads; }
+};
+
+// Every worker keeps its own Highs copy and chains the scenarios it claims,
+// so each solve warm-starts from the previous one's basis
+struct HighsSolveScenariosLocalState : public LocalTableFunctionState {
+  unique_ptr<Highs> highs;
+  const HighsScenario *applied = nullptr;
+  int64_t scenario_id = 0;
+  std::vector<double> solution_values;
+  std::vector<double> reduced_costs;
+  HighsModelStatus model_status = HighsModelStatus::kNotset;
+  double objective_value = 0.0;
+  std::string error;
+  idx_t num_rows = 0;
+  idx_t current_row = 0;
+};
+
+// Table function solving a base model under many scenarios:
+// highs_solve_scenarios(model_name, scenario_query) where the query returns
+// (scenario_id, kind, name, attribute, value); kind is 'variable' or
+// 'constraint' and attribute is 'lower_bound', 'upper_bound' or (variables
+// only) 'obj_coefficient'. Returns the highs_solve columns keyed by
+// scenario_id, plus the scenario's objective value.
+//
+// Like highs_solve_tables, the query runs on a separate connection and
+// does not see the caller's temporary tables, uncommitted rows or
+// search_path (see docs/README.md); one naming something it cannot see
+// fails when the call is bound.
+struct HighsSolveScenariosFunction {
+  // Scenario rows as read from the query, before names are resolved
+  struct ScenarioRow {
+    int64_t scenario_id;
+    HighsScenarioOverride::Target target;
+    std::string name;
+    double value;
+  };
+
+  static std::vector<ScenarioRow>
+  ReadScenarios(ClientContext &context,
+                const HighsSolveScenariosData &bind_data) {
+    using Target = HighsScenarioOverride::Target;
+    std::vector<ScenarioRow> result;
+    Connection con(*context.db);
+    ScanQuery(
+        context, con, bind_data.scenario_query,
+        {LogicalType::BIGINT, LogicalType::VARCHAR, LogicalType::VARCHAR,
+         LogicalType::VARCHAR, LogicalType::DOUBLE},
+        "scenario", [&](DataChunk &chunk) {
+          idx_t count = chunk.size();
+          UnifiedVectorFormat formats[5];
+          for (idx_t col = 0; col < 5; col++) {
+            chunk.data[col].ToUnifiedFormat(count, formats[col]);
+          }
+          auto scenario_ids = UnifiedVectorFormat::GetData<int64_t>(formats[0]);
+          auto kinds = UnifiedVectorFormat::GetData<string_t>(formats[1]);
+          auto names = UnifiedVectorFormat::GetData<string_t>(formats[2]);
+          auto attributes = UnifiedVectorFormat::GetData<string_t>(formats[3]);
+          auto values = UnifiedVectorFormat::GetData<double>(formats[4]);
+
+          for (idx_t row = 0; row < count; row++) {
+            idx_t idx[5];
+            for (idx_t col = 0; col < 5; col++) {
+              idx[col] = formats[col].sel->get_index(row);
+              if (!formats[col].validity.RowIsValid(idx[col])) {
+                throw std::runtime_error(
+                    "scenario query returned a NULL value");
+              }
+            }
+            std::string kind = kinds[idx[1]].GetString();
+            std::string attribute = attributes[idx[3]].GetString();
+
+            ScenarioRow entry;
+            entry.scenario_id = scenario_ids[idx[0]];
+            entry.name = names[idx[2]].GetString();
+            entry.value = values[idx[4]];
+            if (kind == "variable" && attribute == "lower_bound") {
+              entry.target = Target::COL_LOWER;
+            } else if (kind == "variable" && attribute == "upper_bound") {
+              entry.target = Target::COL_UPPER;
+            } else if (kind == "variable" && attribute == "obj_coefficient") {
+              entry.target = Target::COL_COST;
+            } else if (kind == "constraint" && attribute == "lower_bound") {
+              entry.target = Target::ROW_LOWER;
+            } else if (kind == "constraint" && attribute == "upper_bound") {
+              entry.target = Target::ROW_UPPER;
+            } else {
+              throw std::runtime_error("Unsupported scenario override '" +
+                                       kind + "." + attribute + "'");
+            }
+            result.push_back(std::move(entry));
+          }
+        });
+    return result;
+  }
+
+  // Parse the name column as the BIGINT id of an id-keyed model's entry
+  static int64_t ParseScenarioId(const std::string &name) {
+    char *end = nullptr;
+    errno = 0;
+    long long id = std::strtoll(name.c_str(), &end, 10);
+    if (name.empty() || *end != '\0' || errno == ERANGE) {
+      throw std::runtime_error("Scenario name '" + name +
+                               "' is not a BIGINT id");
+    }
+    return id;
+  }
+
+  // Resolve names (or ids, for a model keyed by ids) against the model and
+  // group the overrides by scenario. The caller must hold the model mutex.
+  static void GroupScenarios(const std::string &model_name,
+                             const HighsModelInfo &model_info,
+                             std::vector<ScenarioRow> &rows,
+                             std::vector<HighsScenario> &scenarios) {
+    using Target = HighsScenarioOverride::Target;
+    bool id_keys = model_info.key_type == HighsKeyType::ID;
+    std::map<int64_t, std::vector<HighsScenarioOverride>> grouped;
+    for (auto &row : rows) {
+      HighsScenarioOverride entry;
+      entry.target = row.target;
+      entry.value = row.value;
+      bool is_row =
+          row.target == Target::ROW_LOWER || row.target == Target::ROW_UPPER;
+      std::string key;
+      if (id_keys) {
+        int64_t id = ParseScenarioId(row.name);
+        entry.index = is_row ? model_info.constraint_ids.Find(id)
+                             : model_info.variable_ids.Find(id);
+        key = std::to_string(id);
+      } else {
+        entry.index = is_row ? model_info.constraint_names.Find(row.name)
+                             : model_info.variable_names.Find(row.name);
+        key = "'" + row.name + "'";
+      }
+      if (entry.index < 0) {
+        throw std::runtime_error(std::string(is_row ? "Constraint "
+                                                    : "Variable ") +
+                                 key + " not found in model '" + model_name +
+                                 "'");
+      }
+      grouped[row.scenario_id].push_back(entry);
+    }
+
+    scenarios.reserve(grouped.size());
+    for (auto &entry : grouped) {
+      scenarios.push_back({entry.first, std::move(entry.second)});
+    }
+  }
+
+  // Put the entries touched by the previous scenario back to their base
+  // values, then apply the next scenario's overrides
+  static void ApplyScenario(const HighsLp &base, Highs &highs,
+                            const HighsScenario *previous,
+                            const HighsScenario &scenario) {
+    using Target = HighsScenarioOverride::Target;
+    if (previous) {
+      for (const auto &entry : previous->overrides) {
+        int i = entry.index;
+        if (entry.target == Target::ROW_LOWER ||
+            entry.target == Target::ROW_UPPER) {
+          highs.changeRowBounds(i, base.row_lower_[i], base.row_upper_[i]);
+        } else {
+          highs.changeColBounds(i, base.col_lower_[i], base.col_upper_[i]);
+          highs.changeColCost(i, base.col_cost_[i]);
+        }
+      }
+    }
+    for (const auto &entry : scenario.overrides) {
+      const HighsLp &lp = highs.getLp();
+      int i = entry.index;
+      switch (entry.target) {
+      case Target::COL_LOWER:
+        highs.changeColBounds(i, entry.value, lp.col_upper_[i]);
+        break;
+      case Target::COL_UPPER:
+        highs.changeColBounds(i, lp.col_lower_[i], entry.value);
+        break;
+      case Target::COL_COST:
+        highs.changeColCost(i, entry.value);
+        break;
+      case Target::ROW_LOWER:
+        highs.changeRowBounds(i, entry.value, lp.row_upper_[i]);
+        break;
+      case Target::ROW_UPPER:
+        highs.changeRowBounds(i, lp.row_lower_[i], entry.value);
+        break;
+      }
+    }
+  }
+
+  static void SolveScenario(ClientContext &context,
+                            HighsSolveScenariosGlobalState &global_state,
+                            HighsSolveScenariosLocalState &local_state,
+                            const HighsScenario &scenario) {
+    local_state.scenario_id = scenario.scenario_id;
+    local_state.current_row = 0;
+    local_state.error.clear();
+    try {
+      if (!local_state.highs) {
+        local_state.highs = make_uniq<Highs>();
+        ApplyHighsOptions(*local_state.highs, global_state.options);
+        // Thousands of scenario solves would flood the log
+        local_state.highs->setOptionValue("output_flag", false);
+        if (local_state.highs->passModel(*global_state.base_lp) !=
+            HighsStatus::kOk) {
+          throw std::runtime_error("Failed to pass model to HiGHS");
+        }
+      }
+      Highs &highs = *local_state.highs;
+      ApplyScenario(*global_state.base_lp, highs, local_state.applied,
+                    scenario);
+      local_state.applied = &scenario;
+      HighsSolveSlot slot(context, highs, global_state.options,
+                          global_state.max_threads);
+      HighsRunMonitor monitor;
+      monitor.WatchInterrupt(&context.interrupted);
+      HighsMonitorScope scope(highs, monitor);
+      if (highs.run() == HighsStatus::kError) {
+        throw std::runtime_error("Failed to solve model");
+      }
+      const HighsSolution &solution = highs.getSolution();
+      local_state.solution_values = solution.col_value;
+      local_state.reduced_costs = solution.col_dual;
+      local_state.model_status = highs.getModelStatus();
+      local_state.objective_value = highs.getInfo().objective_function_value;
+      local_state.num_rows = global_state.columns.count;
+    } catch (const std::exception &e) {
+      local_state.error = e.what();
+      local_state.num_rows = 1;
+    }
+  }
+
+  static void EmitScenarioBatch(DataChunk &output,
+                                HighsSolveScenariosGlobalState &global_state,
+                                HighsSolveScenariosLocalState &local_state) {
+    idx_t current_row = local_state.current_row;
+    idx_t batch_size = std::min(local_state.num_rows - current_row,
+                                (idx_t)STANDARD_VECTOR_SIZE);
+    output.SetCardinality(batch_size);
+    auto scenario_id_vector = FlatVector::GetData<int64_t>(output.data[0]);
+    auto variable_name_vector = FlatVector::GetData<string_t>(output.data[1]);
+    auto variable_index_vector = FlatVector::GetData<string_t>(output.data[2]);
+    auto solution_value_vector = FlatVector::GetData<double>(output.data[3]);
+    auto reduced_cost_vector = FlatVector::GetData<double>(output.data[4]);
+    auto objective_vector = FlatVector::GetData<double>(output.data[5]);
+    auto status_vector = FlatVector::GetData<string_t>(output.data[6]);
+
+    if (!local_state.error.empty()) {
+      scenario_id_vector[0] = local_state.scenario_id;
+      variable_name_vector[0] = StringVector::AddString(output.data[1], "N/A");
+      variable_index_vector[0] =
+          StringVector::AddString(output.data[2], "ERROR");
+      solution_value_vector[0] = 0.0;
+      reduced_cost_vector[0] = 0.0;
+      objective_vector[0] = 0.0;
+      status_vector[0] = StringVector::AddString(
+          output.data[6], "ERROR: " + local_state.error);
+      local_state.current_row += batch_size;
+      return;
+    }
+
+    EmitColumnNames(global_state.columns, current_row, batch_size,
+                    output.data[1], output.data[2]);
+    string_t status = StringVector::AddString(
+        output.data[6], ModelStatusToString(local_state.model_status));
+    for (idx_t i = 0; i < batch_size; i++) {
+      idx_t var_idx = current_row + i;
+      scenario_id_vector[i] = local_state.scenario_id;
+      solution_value_vector[i] = local_state.solution_values.size() > var_idx
+                                     ? local_state.solution_values[var_idx]
+                                     : 0.0;
+      reduced_cost_vector[i] = local_state.reduced_costs.size() > var_idx
+                                   ? local_state.reduced_costs[var_idx]
+                                   : 0.0;
+      objective_vector[i] = local_state.objective_value;
+      status_vector[i] = status;
+    }
+    local_state.current_row += batch_size;
+  }
+
+  static void SolveScenariosFunction(ClientContext &context,
+                                     TableFunctionInput &data_p,
+                                     DataChunk &output) {
+    auto &global_state =
+        data_p.global_state->Cast<HighsSolveScenariosGlobalState>();
+    auto &local_state =
+        data_p.local_state->Cast<HighsSolveScenariosLocalState>();
+
+    if (!global_state.error.empty()) {
+      if (global_state.error_emitted.exchange(true)) {
+        output.SetCardinality(0);
+        return;
+      }
+      local_state.error = global_state.error;
+      local_state.num_rows = 1;
+      EmitScenarioBatch(output, global_state, local_state);
+      return;
+    }
+
+    while (local_state.current_row >= local_state.num_rows) {
+      idx_t next = global_state.next_scenario++;
+      if (next >= global_state.scenarios.size()) {
+        output.SetCardinality(0);
+        return;
+      }
+      SolveScenario(context, global_state, local_state,
+                    global_state.scenarios[next]);
+      if (context.interrupted) {
+        throw InterruptException();
+      }
+    }
+    EmitScenarioBatch(output, global_state, local_state);
+  }
+
+  // Progress bar: scenarios handed out so far
+  static double SolveScenariosProgress(
+      ClientContext &context, const FunctionData *bind_data,
+      const GlobalTableFunctionState *global_state) {
+    auto &state = global_state->Cast<HighsSolveScenariosGlobalState>();
+    if (state.scenarios.empty()) {
+      return 100;
+    }
+    idx_t started = MinValue<idx_t>(state.next_scenario.load(),
+                                    state.scenarios.size());
+    return 100.0 * (double)started / (double)state.scenarios.size();
+  }
+
+  static unique_ptr<FunctionData>
+  SolveScenariosBind(ClientContext &context, TableFunctionBindInput &input,
+                     vector<LogicalType> &return_types,
+                     vector<string> &names) {
+    auto result = make_uniq<HighsSolveScenariosData>();
+
+    if (input.inputs.size() != 2) {
+      throw BinderException(
+          "highs_solve_scenarios expects exactly 2 parameters: model_name, "
+          "scenario_query");
+    }
+
+    result->model_name = input.inputs[0].GetValue<string>();
+    result->scenario_query = input.inputs[1].GetValue<string>();
+    CheckSideQuery(context, "highs_solve_scenarios", "scenario",
+                   result->scenario_query, 5);
+
+    // Define output schema
+    names.emplace_back("scenario_id");
+    return_types.emplace_back(LogicalType::BIGINT);
+    names.emplace_back("variable_name");
+    return_types.emplace_back(LogicalType::VARCHAR);
+    names.emplace_back("variable_index");
+    return_types.emplace_back(LogicalType::VARCHAR);
+    names.emplace_back("solution_value");
+    return_types.emplace_back(LogicalType::DOUBLE);
+    names.emplace_back("reduced_cost");
+    return_types.emplace_back(LogicalType::DOUBLE);
+    names.emplace_back("objective_value");
+    return_types.emplace_back(LogicalType::DOUBLE);
+    names.emplace_back("status");
+    return_types.emplace_back(LogicalType::VARCHAR);
+
+    return std::move(result);
+  }
+
+  static unique_ptr<GlobalTableFunctionState>
+  SolveScenariosInit(ClientContext &context, TableFunctionInitInput &input) {
+    auto &bind_data = input.bind_data->Cast<HighsSolveScenariosData>();
+    auto result = make_uniq<HighsSolveScenariosGlobalState>();
+
+    auto model_info =
+        HighsModelRegistry::Instance().GetModel(bind_data.model_name);
+    if (!model_info) {
+      result->error = "Model '" + bind_data.model_name + "' not found";
+      return std::move(result);
+    }
+
+    try {
+      auto num_threads =
+          (idx_t)TaskScheduler::GetScheduler(context).NumberOfThreads();
+      auto rows = ReadScenarios(context, bind_data);
+      {
+        HighsSharedLock guard(model_info->mutex);
+        result->base_lp =
+            std::make_shared<const HighsLp>(model_info->AssembleLp(
+                HighsSolveWidth(HighsThreadSettings::FromContext(context),
+                                model_info->options)));
+        result->columns.SnapshotColumns(*model_info);
+        result->options = model_info->options;
+        GroupScenarios(bind_data.model_name, *model_info, rows,
+                       result->scenarios);
+      }
+      result->max_threads =
+          MaxValue<idx_t>(1, MinValue<idx_t>(num_threads,
+                                             result->scenarios.size()));
+    } catch (const std::exception &e) {
+      result->error = e.what();
+    }
+    return std::move(result);
+  }
+
+  static unique_ptr<LocalTableFunctionState>
+  SolveScenariosInitLocal(ExecutionContext &context,
+                          TableFunctionInitInput &input,
+                          GlobalTableFunctionState *global_state) {
+    return make_uniq<HighsSolveScenariosLocalState>();
+  }
+};
+
+static void LoadInternal(DuckDB &db) {
+  // SET highs_threading = 'auto' | 'duckdb' | 'highs'; see HighsSolveSlot
+  auto &config = DBConfig::GetConfig(*db.instance);
+  config.AddExtensionOption(
+      "highs_threading",
+      "How HiGHS shares cores with DuckDB: 'auto' sizes the HiGHS pool from "
+      "the DuckDB threads setting and concurrent solves, 'duckdb' runs HiGHS "
+      "single-threaded so parallelism comes from DuckDB workers, 'highs' "
+      "keeps the HiGHS default pool",
+      LogicalType::VARCHAR, Value("auto"), SetHighsThreadingMode);
+
+  // SET highs_result_cache_size = <results>; see HighsResultCache
+  config.AddExtensionOption(
+      "highs_result_cache_size",
+      "Number of solve results kept for reuse by solves of an identical LP "
+      "with identical options, across all models; 0 disables the cache",
+      LogicalType::UBIGINT,
+      Value::UBIGINT(HighsResultCache::kDefaultCapacity),
+      SetHighsResultCacheSize);
+
+  // Register HiGHS version functions
+  auto highs_version_function =
+      ScalarFunction("highs_version", {LogicalType::VARCHAR},
+                     LogicalType::VARCHAR, HighsVersionScalarFun);
+  ExtensionUtil::RegisterFunction(*db.instance, highs_version_function);
+
+  auto highs_openssl_version_function =
+      ScalarFunction("highs_openssl_version", {LogicalType::VARCHAR},
+                     LogicalType::VARCHAR, HighsOpenSSLVersionScalarFun);
+  ExtensionUtil::RegisterFunction(*db.instance, highs_openssl_version_function);
+
+  // Register optimization table functions
+  // highs_create_variables(model_name, variable_name, lower_bound, upper_bound,
+  // obj_coefficient, var_type)
+  TableFunction create_variables_function(
+      "highs_create_variables",
+      {LogicalType::VARCHAR, LogicalType::VARCHAR, LogicalType::DOUBLE,
+       LogicalType::DOUBLE, LogicalType::DOUBLE, LogicalType::VARCHAR},
+      HighsCreateVariablesFunction::CreateVariablesFunction,
+      HighsCreateVariablesFunction::CreateVariablesBind,
+      HighsCreateVariablesFunction::CreateVariablesInit);
+
+  // highs_create_variables((SELECT model_name, variable_name, lower_bound,
+  // upper_bound, obj_coefficient, var_type FROM ...))
+  TableFunction create_variables_bulk_function(
+      "highs_create_variables", {LogicalType::TABLE}, nullptr,
+      HighsCreateVariablesFunction::CreateVariablesBulkBind, nullptr,
+      HighsCreateVariablesFunction::CreateVariablesBulkInitLocal);
+  create_variables_bulk_function.in_out_function =
+      HighsCreateVariablesFunction::CreateVariablesBulkFunction;
+
+  TableFunctionSet create_variables_set("highs_create_variables");
+  create_variables_set.AddFunction(create_variables_function);
+  create_variables_set.AddFunction(create_variables_bulk_function);
+  ExtensionUtil::RegisterFunction(*db.instance, create_variables_set);
+
+  // highs_create_constraints(model_name, constraint_name, lower_bound,
+  // upper_bound)
+  TableFunction create_constraints_function(
+      "highs_create_constraints",
+      {LogicalType::VARCHAR, LogicalType::VARCHAR, LogicalType::DOUBLE,
+       LogicalType::DOUBLE},
+      HighsCreateConstraintsFunction::CreateConstraintsFunction,
+      HighsCreateConstraintsFunction::CreateConstraintsBind,
+      HighsCreateConstraintsFunction::CreateConstraintsInit);
+
+  // highs_create_constraints((SELECT model_name, constraint_name,
+  // lower_bound, upper_bound FROM ...))
+  TableFunction create_constraints_bulk_function(
+      "highs_create_constraints", {LogicalType::TABLE}, nullptr,
+      HighsCreateConstraintsFunction::CreateConstraintsBulkBind, nullptr,
+      HighsCreateConstraintsFunction::CreateConstraintsBulkInitLocal);
+  create_constraints_bulk_function.in_out_function =
+      HighsCreateConstraintsFunction::CreateConstraintsBulkFunction;
+
+  TableFunctionSet create_constraints_set("highs_create_constraints");
+  create_constraints_set.AddFunction(create_constraints_function);
+  create_constraints_set.AddFunction(create_constraints_bulk_function);
+  ExtensionUtil::RegisterFunction(*db.instance, create_constraints_set);
+
+  // highs_set_coefficients(model_name, constraint_name, variable_name,
   // coefficient)
   TableFunction set_coefficients_function(
       "highs_set_coefficients",
@@ -766,13 +4372,261 @@ static void LoadInternal(DuckDB &db) {
       HighsSetCoefficientsFunction::SetCoefficientsFunction,
       HighsSetCoefficientsFunction::SetCoefficientsBind,
       HighsSetCoefficientsFunction::SetCoefficientsInit);
-  ExtensionUtil::RegisterFunction(*db.instance, set_coefficients_function);
+
+  // highs_set_coefficients((SELECT model_name, constraint_name,
+  // variable_name, coefficient FROM ...))
+  TableFunction set_coefficients_bulk_function(
+      "highs_set_coefficients", {LogicalType::TABLE}, nullptr,
+      HighsSetCoefficientsFunction::SetCoefficientsBulkBind, nullptr,
+      HighsSetCoefficientsFunction::SetCoefficientsBulkInitLocal);
+  set_coefficients_bulk_function.in_out_function =
+      HighsSetCoefficientsFunction::SetCoefficientsBulkFunction;
+  set_coefficients_bulk_function.in_out_function_final =
+      HighsSetCoefficientsFunction::SetCoefficientsBulkFinal;
+
+  TableFunctionSet set_coefficients_set("highs_set_coefficients");
+  set_coefficients_set.AddFunction(set_coefficients_function);
+  set_coefficients_set.AddFunction(set_coefficients_bulk_function);
+  ExtensionUtil::RegisterFunction(*db.instance, set_coefficients_set);
+
+  // highs_update_variable(model_name, variable_name | variable_id,
+  // lower_bound, upper_bound, obj_coefficient)
+  TableFunctionSet update_variable_set("highs_update_variable");
+  for (auto &key_type : {LogicalType::VARCHAR, LogicalType::BIGINT}) {
+    update_variable_set.AddFunction(TableFunction(
+        "highs_update_variable",
+        {LogicalType::VARCHAR, key_type, LogicalType::DOUBLE,
+         LogicalType::DOUBLE, LogicalType::DOUBLE},
+        HighsUpdateFunction::UpdateVariableFunction,
+        HighsUpdateFunction::UpdateVariableBind,
+        HighsUpdateFunction::UpdateInit));
+  }
+  ExtensionUtil::RegisterFunction(*db.instance, update_variable_set);
+
+  // highs_update_constraint(model_name, constraint_name | constraint_id,
+  // lower_bound, upper_bound)
+  TableFunctionSet update_constraint_set("highs_update_constraint");
+  for (auto &key_type : {LogicalType::VARCHAR, LogicalType::BIGINT}) {
+    update_constraint_set.AddFunction(TableFunction(
+        "highs_update_constraint",
+        {LogicalType::VARCHAR, key_type, LogicalType::DOUBLE,
+         LogicalType::DOUBLE},
+        HighsUpdateFunction::UpdateConstraintFunction,
+        HighsUpdateFunction::UpdateConstraintBind,
+        HighsUpdateFunction::UpdateInit));
+  }
+  ExtensionUtil::RegisterFunction(*db.instance, update_constraint_set);
+
+  // highs_set_option(model_name, option_name, value)
+  TableFunction set_option_function(
+      "highs_set_option",
+      {LogicalType::VARCHAR, LogicalType::VARCHAR, LogicalType::VARCHAR},
+      HighsSetOptionFunction::SetOptionFunction,
+      HighsSetOptionFunction::SetOptionBind,
+      HighsSetOptionFunction::SetOptionInit);
+  ExtensionUtil::RegisterFunction(*db.instance, set_option_function);
+
+  // highs_read_model(model_name, path) and highs_write_model(model_name,
+  // path)
+  TableFunction read_model_function(
+      "highs_read_model", {LogicalType::VARCHAR, LogicalType::VARCHAR},
+      HighsModelFileFunction::ReadModelFunction,
+      HighsModelFileFunction::ModelFileBind,
+      HighsModelFileFunction::ModelFileInit);
+  ExtensionUtil::RegisterFunction(*db.instance, read_model_function);
+
+  TableFunction write_model_function(
+      "highs_write_model", {LogicalType::VARCHAR, LogicalType::VARCHAR},
+      HighsModelFileFunction::WriteModelFunction,
+      HighsModelFileFunction::ModelFileBind,
+      HighsModelFileFunction::ModelFileInit);
+  ExtensionUtil::RegisterFunction(*db.instance, write_model_function);
+
+  // highs_load_model(model_name, path) and highs_save_model(model_name,
+  // path)
+  TableFunction load_model_function(
+      "highs_load_model", {LogicalType::VARCHAR, LogicalType::VARCHAR},
+      HighsModelFileFunction::ReadModelFunction,
+      HighsModelFileFunction::SnapshotBind,
+      HighsModelFileFunction::ModelFileInit);
+  ExtensionUtil::RegisterFunction(*db.instance, load_model_function);
+
+  TableFunction save_model_function(
+      "highs_save_model", {LogicalType::VARCHAR, LogicalType::VARCHAR},
+      HighsModelFileFunction::WriteModelFunction,
+      HighsModelFileFunction::SnapshotBind,
+      HighsModelFileFunction::ModelFileInit);
+  ExtensionUtil::RegisterFunction(*db.instance, save_model_function);
+
+  // highs_cache_stats()
+  TableFunction cache_stats_function(
+      "highs_cache_stats", {}, HighsCacheStatsFunction::CacheStatsFunction,
+      HighsCacheStatsFunction::CacheStatsBind,
+      HighsCacheStatsFunction::CacheStatsInit);
+  ExtensionUtil::RegisterFunction(*db.instance, cache_stats_function);
+
+  // highs_model_stats(model_name)
+  TableFunction model_stats_function(
+      "highs_model_stats", {LogicalType::VARCHAR},
+      HighsProfileFunctions::ModelStatsFunction,
+      HighsProfileFunctions::ModelStatsBind,
+      HighsProfileFunctions::ProfileInit);
+  ExtensionUtil::RegisterFunction(*db.instance, model_stats_function);
+
+  // highs_solve_profile(model_name)
+  TableFunction solve_profile_function(
+      "highs_solve_profile", {LogicalType::VARCHAR},
+      HighsProfileFunctions::SolveProfileFunction,
+      HighsProfileFunctions::SolveProfileBind,
+      HighsProfileFunctions::ProfileInit);
+  ExtensionUtil::RegisterFunction(*db.instance, solve_profile_function);
+
+  // highs_memory() and highs_spill_models(idle_seconds)
+  TableFunction memory_function("highs_memory", {},
+                                HighsMemoryFunctions::MemoryFunction,
+                                HighsMemoryFunctions::MemoryBind,
+                                HighsMemoryFunctions::MemoryInit);
+  ExtensionUtil::RegisterFunction(*db.instance, memory_function);
+  TableFunction spill_models_function("highs_spill_models",
+                                      {LogicalType::DOUBLE},
+                                      HighsMemoryFunctions::SpillFunction,
+                                      HighsMemoryFunctions::SpillBind,
+                                      HighsMemoryFunctions::SpillInit);
+  ExtensionUtil::RegisterFunction(*db.instance, spill_models_function);
+
+  // highs_ranging(model_name)
+  TableFunction ranging_function("highs_ranging", {LogicalType::VARCHAR},
+                                 HighsRangingFunction::RangingFunction,
+                                 HighsRangingFunction::RangingBind,
+                                 HighsRangingFunction::RangingInit);
+  ExtensionUtil::RegisterFunction(*db.instance, ranging_function);
 
   // highs_solve(model_name)
   TableFunction solve_function(
       "highs_solve", {LogicalType::VARCHAR}, HighsSolveFunction::SolveFunction,
       HighsSolveFunction::SolveBind, HighsSolveFunction::SolveInit);
+  solve_function.projection_pushdown = true;
+  solve_function.filter_pushdown = true;
+  solve_function.table_scan_progress = SolveProgress;
   ExtensionUtil::RegisterFunction(*db.instance, solve_function);
+
+  // highs_solve_ids(model_name)
+  TableFunction solve_ids_function("highs_solve_ids", {LogicalType::VARCHAR},
+                                   HighsSolveFunction::SolveFunction,
+                                   HighsSolveFunction::SolveIdsBind,
+                                   HighsSolveFunction::SolveInit);
+  solve_ids_function.projection_pushdown = true;
+  solve_ids_function.filter_pushdown = true;
+  solve_ids_function.table_scan_progress = SolveProgress;
+  ExtensionUtil::RegisterFunction(*db.instance, solve_ids_function);
+
+  // highs_solve_constraints(model_name)
+  TableFunction solve_constraints_function(
+      "highs_solve_constraints", {LogicalType::VARCHAR},
+      HighsSolveFunction::SolveFunction,
+      HighsSolveFunction::SolveConstraintsBind, HighsSolveFunction::SolveInit);
+  solve_constraints_function.projection_pushdown = true;
+  solve_constraints_function.filter_pushdown = true;
+  solve_constraints_function.table_scan_progress = SolveProgress;
+  ExtensionUtil::RegisterFunction(*db.instance, solve_constraints_function);
+
+  // highs_solve_decomposed(model_name, min_block_size := 1024)
+  TableFunction solve_decomposed_function(
+      "highs_solve_decomposed", {LogicalType::VARCHAR},
+      HighsSolveFunction::SolveFunction,
+      HighsSolveFunction::SolveDecomposedBind, HighsSolveFunction::SolveInit);
+  solve_decomposed_function.named_parameters["min_block_size"] =
+      LogicalType::UBIGINT;
+  solve_decomposed_function.projection_pushdown = true;
+  solve_decomposed_function.filter_pushdown = true;
+  solve_decomposed_function.table_scan_progress = SolveProgress;
+  ExtensionUtil::RegisterFunction(*db.instance, solve_decomposed_function);
+
+  // highs_solve_async(model_name), highs_jobs(), highs_wait(job_id),
+  // highs_cancel(job_id) and highs_job_solution(job_id)
+  TableFunction solve_async_function(
+      "highs_solve_async", {LogicalType::VARCHAR},
+      HighsJobFunctions::SolveAsyncFunction, HighsJobFunctions::SolveAsyncBind,
+      HighsJobFunctions::SingleRowInit);
+  ExtensionUtil::RegisterFunction(*db.instance, solve_async_function);
+
+  TableFunction jobs_function("highs_jobs", {},
+                              HighsJobFunctions::JobsFunction,
+                              HighsJobFunctions::JobsBind,
+                              HighsJobFunctions::JobsInit);
+  ExtensionUtil::RegisterFunction(*db.instance, jobs_function);
+
+  TableFunction wait_function(
+      "highs_wait", {LogicalType::BIGINT}, HighsJobFunctions::WaitFunction,
+      HighsJobFunctions::WaitBind, HighsJobFunctions::SingleRowInit);
+  ExtensionUtil::RegisterFunction(*db.instance, wait_function);
+
+  TableFunction cancel_function(
+      "highs_cancel", {LogicalType::BIGINT}, HighsJobFunctions::CancelFunction,
+      HighsJobFunctions::CancelBind, HighsJobFunctions::SingleRowInit);
+  ExtensionUtil::RegisterFunction(*db.instance, cancel_function);
+
+  TableFunction job_solution_function(
+      "highs_job_solution", {LogicalType::BIGINT},
+      HighsSolveFunction::SolveFunction, HighsSolveFunction::JobSolutionBind,
+      HighsSolveFunction::SolveInit);
+  job_solution_function.projection_pushdown = true;
+  job_solution_function.filter_pushdown = true;
+  job_solution_function.table_scan_progress = SolveProgress;
+  ExtensionUtil::RegisterFunction(*db.instance, job_solution_function);
+
+  // highs_solve_incumbents(model_name, changes_only := false)
+  TableFunction solve_incumbents_function(
+      "highs_solve_incumbents", {LogicalType::VARCHAR},
+      HighsSolveIncumbentsFunction::SolveIncumbentsFunction,
+      HighsSolveIncumbentsFunction::SolveIncumbentsBind,
+      HighsSolveIncumbentsFunction::SolveIncumbentsInit);
+  solve_incumbents_function.named_parameters["changes_only"] =
+      LogicalType::BOOLEAN;
+  ExtensionUtil::RegisterFunction(*db.instance, solve_incumbents_function);
+
+  // highs_solve_tables(variables_query, constraints_query,
+  // coefficients_query)
+  TableFunction solve_tables_function(
+      "highs_solve_tables",
+      {LogicalType::VARCHAR, LogicalType::VARCHAR, LogicalType::VARCHAR},
+      HighsSolveTablesFunction::SolveTablesFunction,
+      HighsSolveTablesFunction::SolveTablesBind,
+      HighsSolveTablesFunction::SolveTablesInit);
+  solve_tables_function.projection_pushdown = true;
+  solve_tables_function.filter_pushdown = true;
+  solve_tables_function.table_scan_progress = SolveProgress;
+  ExtensionUtil::RegisterFunction(*db.instance, solve_tables_function);
+
+  // highs_solve_agg(variable_name, constraint_name, coefficient,
+  // lower_bound, upper_bound, obj_coefficient), an aggregate
+  AggregateFunction solve_agg_function(
+      "highs_solve_agg",
+      {LogicalType::VARCHAR, LogicalType::VARCHAR, LogicalType::DOUBLE,
+       LogicalType::DOUBLE, LogicalType::DOUBLE, LogicalType::DOUBLE},
+      HighsSolveAggFunction::ReturnType(),
+      AggregateFunction::StateSize<HighsSolveAggState>,
+      AggregateFunction::StateInitialize<HighsSolveAggState,
+                                         HighsSolveAggFunction>,
+      HighsSolveAggFunction::Update, HighsSolveAggFunction::Combine,
+      HighsSolveAggFunction::Finalize, FunctionNullHandling::SPECIAL_HANDLING,
+      HighsSolveAggFunction::SimpleUpdate, HighsSolveAggFunction::Bind,
+      AggregateFunction::StateDestroy<HighsSolveAggState,
+                                      HighsSolveAggFunction>);
+  solve_agg_function.order_dependent =
+      AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+  ExtensionUtil::RegisterFunction(*db.instance, solve_agg_function);
+
+  // highs_solve_scenarios(model_name, scenario_query)
+  TableFunction solve_scenarios_function(
+      "highs_solve_scenarios", {LogicalType::VARCHAR, LogicalType::VARCHAR},
+      HighsSolveScenariosFunction::SolveScenariosFunction,
+      HighsSolveScenariosFunction::SolveScenariosBind,
+      HighsSolveScenariosFunction::SolveScenariosInit,
+      HighsSolveScenariosFunction::SolveScenariosInitLocal);
+  solve_scenarios_function.table_scan_progress =
+      HighsSolveScenariosFunction::SolveScenariosProgress;
+  ExtensionUtil::RegisterFunction(*db.instance, solve_scenarios_function);
 }
 
 } // namespace duckdb
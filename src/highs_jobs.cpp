@@ -0,0 +1,220 @@
+#include "highs_jobs.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace duckdb {
+
+constexpr idx_t HighsJobManager::kMaxEndedJobs;
+
+const char *JobStateToString(HighsJobState state) {
+  switch (state) {
+  case HighsJobState::QUEUED:
+    return "QUEUED";
+  case HighsJobState::RUNNING:
+    return "RUNNING";
+  case HighsJobState::FINISHED:
+    return "FINISHED";
+  case HighsJobState::FAILED:
+    return "FAILED";
+  default:
+    return "CANCELLED";
+  }
+}
+
+HighsJobManager &HighsJobManager::Instance() {
+  static HighsJobManager instance;
+  return instance;
+}
+
+HighsJobManager::HighsJobManager() {
+  // Every worker blocks a thread in HiGHS for the length of a solve; keep
+  // them to half the machine so the rest is left to DuckDB
+  max_workers = MaxValue<idx_t>(1, std::thread::hardware_concurrency() / 2);
+}
+
+HighsJobManager::~HighsJobManager() {
+  {
+    std::lock_guard<std::mutex> guard(mutex);
+    shutdown = true;
+    for (auto &entry : jobs) {
+      entry.second->monitor.Cancel();
+    }
+  }
+  work_available.notify_all();
+  for (auto &worker : workers) {
+    worker.join();
+  }
+}
+
+int64_t HighsJobManager::Submit(const std::string &model_name,
+                                std::shared_ptr<HighsModelInfo> model_info,
+                                const HighsThreadSettings &settings) {
+  auto job = std::make_shared<HighsJob>();
+  job->model_name = model_name;
+  job->model_info = std::move(model_info);
+  job->settings = settings;
+
+  std::lock_guard<std::mutex> guard(mutex);
+  job->job_id = next_job_id++;
+  jobs[job->job_id] = job;
+  queue.push_back(job);
+  if (idle_workers < queue.size() && workers.size() < max_workers) {
+    workers.emplace_back(&HighsJobManager::WorkerLoop, this);
+  } else {
+    work_available.notify_one();
+  }
+  return job->job_id;
+}
+
+void HighsJobManager::WorkerLoop() {
+  std::unique_lock<std::mutex> guard(mutex);
+  while (true) {
+    idle_workers++;
+    work_available.wait(guard, [this]() { return shutdown || !queue.empty(); });
+    idle_workers--;
+    if (shutdown) {
+      return;
+    }
+    auto job = queue.front();
+    queue.pop_front();
+    if (job->state != HighsJobState::QUEUED) {
+      continue; // cancelled while queued
+    }
+    job->state = HighsJobState::RUNNING;
+    job->started = std::chrono::steady_clock::now();
+
+    guard.unlock();
+    std::shared_ptr<const HighsSolveResult> result;
+    std::string error;
+    try {
+      result = SolveModel(*job->model_info, job->settings, &job->monitor);
+    } catch (const std::exception &e) {
+      error = e.what();
+    }
+    guard.lock();
+
+    job->finished = std::chrono::steady_clock::now();
+    job->result = std::move(result);
+    job->error = std::move(error);
+    // A job cancelled while waiting for another solve of its model ends
+    // with an InterruptException, which is not a failure
+    if (job->monitor.CancelRequested()) {
+      job->state = HighsJobState::CANCELLED;
+      job->error.clear();
+    } else if (!job->error.empty()) {
+      job->state = HighsJobState::FAILED;
+    } else {
+      job->state = HighsJobState::FINISHED;
+    }
+    // The model may be dropped while its results are still wanted
+    job->model_info.reset();
+    JobEnded(job->job_id);
+  }
+}
+
+void HighsJobManager::JobEnded(int64_t job_id) {
+  ended.push_back(job_id);
+  while (ended.size() > kMaxEndedJobs) {
+    jobs.erase(ended.front());
+    ended.pop_front();
+  }
+  job_ended.notify_all();
+}
+
+std::vector<HighsJobInfo> HighsJobManager::List() {
+  std::vector<HighsJobInfo> infos;
+  auto now = std::chrono::steady_clock::now();
+  std::lock_guard<std::mutex> guard(mutex);
+  for (auto &entry : jobs) {
+    auto &job = *entry.second;
+    HighsJobInfo info;
+    info.job_id = job.job_id;
+    info.model_name = job.model_name;
+    info.state = job.state;
+    info.model_status =
+        job.result ? job.result->model_status : HighsModelStatus::kNotset;
+    info.objective_value =
+        job.result ? job.result->objective_value : job.monitor.Objective();
+    info.mip_gap = job.monitor.Gap();
+    info.runtime_seconds = 0;
+    if (job.state != HighsJobState::QUEUED &&
+        job.started != std::chrono::steady_clock::time_point()) {
+      auto end = job.state == HighsJobState::RUNNING ? now : job.finished;
+      info.runtime_seconds =
+          std::chrono::duration<double>(end - job.started).count();
+    }
+    info.error = job.error;
+    infos.push_back(std::move(info));
+  }
+  return infos;
+}
+
+std::shared_ptr<HighsJob> HighsJobManager::FindJob(int64_t job_id) {
+  auto it = jobs.find(job_id);
+  if (it == jobs.end()) {
+    throw std::runtime_error("Job " + std::to_string(job_id) + " not found");
+  }
+  return it->second;
+}
+
+HighsJobState HighsJobManager::Cancel(int64_t job_id) {
+  std::lock_guard<std::mutex> guard(mutex);
+  auto job = FindJob(job_id);
+  auto state = job->state;
+  switch (state) {
+  case HighsJobState::QUEUED:
+    // The worker that dequeues it skips it
+    job->state = HighsJobState::CANCELLED;
+    job->model_info.reset();
+    JobEnded(job_id);
+    break;
+  case HighsJobState::RUNNING:
+    job->monitor.Cancel();
+    break;
+  default: {
+    jobs.erase(job_id);
+    auto position = std::find(ended.begin(), ended.end(), job_id);
+    if (position != ended.end()) {
+      ended.erase(position);
+    }
+    break;
+  }
+  }
+  return state;
+}
+
+std::shared_ptr<const HighsSolveResult>
+HighsJobManager::Result(int64_t job_id) {
+  std::lock_guard<std::mutex> guard(mutex);
+  auto job = FindJob(job_id);
+  if (job->result) {
+    return job->result;
+  }
+  std::string prefix = "Job " + std::to_string(job_id);
+  switch (job->state) {
+  case HighsJobState::FAILED:
+    throw std::runtime_error(prefix + " failed: " + job->error);
+  case HighsJobState::CANCELLED:
+    throw std::runtime_error(prefix + " was cancelled");
+  default:
+    throw std::runtime_error(prefix + " has not finished");
+  }
+}
+
+HighsJobState HighsJobManager::Wait(int64_t job_id,
+                                    const std::atomic<bool> &interrupted) {
+  std::unique_lock<std::mutex> guard(mutex);
+  auto job = FindJob(job_id);
+  while (job->state == HighsJobState::QUEUED ||
+         job->state == HighsJobState::RUNNING) {
+    if (interrupted) {
+      throw InterruptException();
+    }
+    // Wake up now and then to notice an interrupt
+    job_ended.wait_for(guard, std::chrono::milliseconds(50));
+  }
+  return job->state;
+}
+
+} // namespace duckdb
@@ -0,0 +1,335 @@
+#include "highs_matrix.hpp"
+
+#include <algorithm>
+#include <thread>
+
+namespace duckdb {
+
+namespace {
+
+// Below this many nonzeros the thread start-up cost outweighs the work
+constexpr size_t kMinParallelNnz = 1 << 16;
+
+template <class FUNC>
+void ParallelFor(size_t num_threads, FUNC &&func) {
+  if (num_threads <= 1) {
+    func(0);
+    return;
+  }
+  std::vector<std::thread> workers;
+  workers.reserve(num_threads - 1);
+  for (size_t t = 1; t < num_threads; t++) {
+    workers.emplace_back([&func, t]() { func(t); });
+  }
+  func(0);
+  for (auto &worker : workers) {
+    worker.join();
+  }
+}
+
+// Stored coefficients; a unit of work is one entry
+struct StoreSource {
+  const HighsCoefficientStore &coefficients;
+
+  size_t NumUnits() const { return coefficients.Size(); }
+
+  template <class FUNC>
+  void ForEach(size_t begin, size_t end, FUNC &&func) const {
+    coefficients.ForEach(begin, end, [&](int row, int col, double value) {
+      func((HighsInt)row, col, value);
+    });
+  }
+};
+
+// Stored coefficients from position offset on, transposed so that rows
+// take the place of columns; entries of rows before first_row are skipped
+struct TransposedStoreSource {
+  const HighsCoefficientStore &coefficients;
+  size_t offset;
+  int first_row;
+
+  size_t NumUnits() const { return coefficients.Size() - offset; }
+
+  template <class FUNC>
+  void ForEach(size_t begin, size_t end, FUNC &&func) const {
+    coefficients.ForEach(
+        offset + begin, offset + end, [&](int row, int col, double value) {
+          if (row >= first_row) {
+            func((HighsInt)col, row - first_row, value);
+          }
+        });
+  }
+};
+
+// Coordinate triplets; a unit of work is one entry
+struct TripletSource {
+  const int *row_index;
+  const int *col_index;
+  const double *value;
+  size_t nnz;
+
+  size_t NumUnits() const { return nnz; }
+
+  template <class FUNC>
+  void ForEach(size_t begin, size_t end, FUNC &&func) const {
+    for (size_t k = begin; k < end; k++) {
+      func((HighsInt)row_index[k], col_index[k], value[k]);
+    }
+  }
+};
+
+// One stable counting-sort pass: place(position, row, col, value) is
+// called for every entry of the source, with positions grouped by
+// key(row, col) and in input order within a key. Every thread keeps one
+// counter per key; num_keys may be 0 when the key range is not known, and
+// the counters then grow to the largest key seen. Returns the start of
+// every key's slice, plus the total at the end.
+template <class SOURCE, class KEY, class PLACE>
+std::vector<size_t> CountingScatter(const SOURCE &source, size_t threads,
+                                    size_t num_keys, KEY &&key,
+                                    PLACE &&place) {
+  const size_t num_units = source.NumUnits();
+  auto unit_begin = [&](size_t t) { return num_units * t / threads; };
+
+  // Per-thread key counts
+  std::vector<std::vector<size_t>> offsets(threads,
+                                           std::vector<size_t>(num_keys, 0));
+  ParallelFor(threads, [&](size_t t) {
+    auto &count = offsets[t];
+    source.ForEach(unit_begin(t), unit_begin(t + 1),
+                   [&](HighsInt row, int col, double) {
+                     size_t k = key(row, col);
+                     if (k >= count.size()) {
+                       count.resize(k + 1, 0);
+                     }
+                     count[k]++;
+                   });
+  });
+  for (auto &count : offsets) {
+    num_keys = std::max(num_keys, count.size());
+  }
+
+  // Exclusive prefix sum in (key, thread) order, so each thread owns a
+  // contiguous slice of every key and entries stay in input order
+  std::vector<size_t> start(num_keys + 1, 0);
+  size_t running = 0;
+  for (auto &count : offsets) {
+    count.resize(num_keys, 0);
+  }
+  for (size_t k = 0; k < num_keys; k++) {
+    start[k] = running;
+    for (size_t t = 0; t < threads; t++) {
+      size_t count = offsets[t][k];
+      offsets[t][k] = running;
+      running += count;
+    }
+  }
+  start[num_keys] = running;
+
+  ParallelFor(threads, [&](size_t t) {
+    auto &position = offsets[t];
+    source.ForEach(unit_begin(t), unit_begin(t + 1),
+                   [&](HighsInt row, int col, double value) {
+                     place(position[key(row, col)]++, row, col, value);
+                   });
+  });
+  return start;
+}
+
+template <class SOURCE>
+void AssembleColwise(HighsInt num_col_p, size_t nnz, const SOURCE &source,
+                     HighsColwiseMatrix &result, size_t num_threads) {
+  const size_t num_col = num_col_p > 0 ? (size_t)num_col_p : 0;
+
+  // Every thread keeps one counter per row and per column, so cap the
+  // thread count to keep that scratch space within a small multiple of nnz
+  size_t threads = std::max<size_t>(1, num_threads);
+  if (nnz < kMinParallelNnz) {
+    threads = 1;
+  }
+  threads = std::min(threads, std::max<size_t>(1, source.NumUnits()));
+  threads =
+      std::min(threads, std::max<size_t>(1, 4 * nnz / (num_col + 1)));
+
+  // Pass 1: bucket entries by row. Two stable counting sorts, by row and
+  // then by column, leave every column sorted by row with duplicates
+  // adjacent and in input order, without a comparison sort.
+  std::vector<int> sorted_row(source.NumUnits());
+  std::vector<int> sorted_col(source.NumUnits());
+  std::vector<double> sorted_value(source.NumUnits());
+  auto row_start = CountingScatter(
+      source, threads, 0, [](HighsInt row, int) { return (size_t)row; },
+      [&](size_t p, HighsInt row, int col, double coeff) {
+        sorted_row[p] = (int)row;
+        sorted_col[p] = col;
+        sorted_value[p] = coeff;
+      });
+  const size_t total = row_start.back();
+  row_start = std::vector<size_t>();
+
+  // Pass 2: scatter the row-ordered entries into their column slots
+  std::vector<HighsInt> index(total);
+  std::vector<double> value(total);
+  TripletSource by_row{sorted_row.data(), sorted_col.data(),
+                       sorted_value.data(), total};
+  auto raw_start = CountingScatter(
+      by_row, threads, num_col, [](HighsInt, int col) { return (size_t)col; },
+      [&](size_t p, HighsInt row, int, double coeff) {
+        index[p] = row;
+        value[p] = coeff;
+      });
+  sorted_row = std::vector<int>();
+  sorted_col = std::vector<int>();
+  sorted_value = std::vector<double>();
+
+  // Pass 3: sum duplicates and drop zeros, compacting every column at the
+  // front of its own slot
+  std::vector<size_t> length(num_col, 0);
+  ParallelFor(threads, [&](size_t t) {
+    size_t col_end = num_col * (t + 1) / threads;
+    for (size_t col = num_col * t / threads; col < col_end; col++) {
+      size_t begin = raw_start[col];
+      size_t end = raw_start[col + 1];
+      size_t out = begin;
+      for (size_t p = begin; p < end;) {
+        HighsInt row = index[p];
+        double sum = 0.0;
+        for (; p < end && index[p] == row; p++) {
+          sum += value[p];
+        }
+        if (sum != 0.0) {
+          index[out] = row;
+          value[out] = sum;
+          out++;
+        }
+      }
+      length[col] = out - begin;
+    }
+  });
+
+  // Close the gaps left by merged entries; destinations never overtake
+  // their sources, so a single forward sweep is safe
+  result.start.resize(num_col + 1);
+  size_t nnz_out = 0;
+  for (size_t col = 0; col < num_col; col++) {
+    result.start[col] = (HighsInt)nnz_out;
+    size_t begin = raw_start[col];
+    if (begin != nnz_out) {
+      std::copy(index.begin() + begin, index.begin() + begin + length[col],
+                index.begin() + nnz_out);
+      std::copy(value.begin() + begin, value.begin() + begin + length[col],
+                value.begin() + nnz_out);
+    }
+    nnz_out += length[col];
+  }
+  result.start[num_col] = (HighsInt)nnz_out;
+  index.resize(nnz_out);
+  value.resize(nnz_out);
+  result.index = std::move(index);
+  result.value = std::move(value);
+}
+
+} // namespace
+
+constexpr size_t HighsCoefficientStore::kMinChunkSize;
+constexpr size_t HighsCoefficientStore::kMaxChunkSize;
+
+size_t HighsCoefficientStore::NextChunkSize(size_t last_entries) {
+  return last_entries == 0 ? kMinChunkSize
+                           : std::min(2 * last_entries, kMaxChunkSize);
+}
+
+void HighsCoefficientStore::AddChunk() {
+  size_t entries = NextChunkSize(
+      chunks.empty() ? 0 : chunks.back().end - chunks.back().begin);
+  Chunk chunk;
+  chunk.begin = Capacity();
+  chunk.end = chunk.begin + entries;
+  chunk.row.reset(new int[entries]);
+  chunk.col.reset(new int[entries]);
+  chunk.value.reset(new double[entries]);
+  chunks.push_back(std::move(chunk));
+}
+
+size_t HighsCoefficientStore::FindChunk(size_t position) const {
+  // Chunks double in size, so there are few of them before the large ones
+  auto it = std::upper_bound(
+      chunks.begin(), chunks.end(), position,
+      [](size_t p, const Chunk &chunk) { return p < chunk.begin; });
+  return it == chunks.begin() ? 0 : (size_t)(it - chunks.begin()) - 1;
+}
+
+void HighsCoefficientStore::Append(const int *row, const int *col,
+                                   const double *value, size_t count) {
+  Reserve(count);
+  while (count > 0) {
+    if (size == chunks[active].end) {
+      active++;
+    }
+    Chunk &chunk = chunks[active];
+    size_t k = size - chunk.begin;
+    size_t n = std::min(count, chunk.end - size);
+    std::copy(row, row + n, chunk.row.get() + k);
+    std::copy(col, col + n, chunk.col.get() + k);
+    std::copy(value, value + n, chunk.value.get() + k);
+    row += n;
+    col += n;
+    value += n;
+    size += n;
+    count -= n;
+  }
+}
+
+void HighsCoefficientStore::Reserve(size_t count) {
+  while (Capacity() < size + count) {
+    AddChunk();
+  }
+}
+
+size_t HighsCoefficientStore::ReserveBytes(size_t count) const {
+  size_t capacity = Capacity();
+  size_t entries =
+      chunks.empty() ? 0 : chunks.back().end - chunks.back().begin;
+  size_t added = 0;
+  while (capacity + added < size + count) {
+    entries = NextChunkSize(entries);
+    added += entries;
+  }
+  return added * (2 * sizeof(int) + sizeof(double));
+}
+
+void HighsCoefficientStore::Clear() {
+  chunks = std::vector<Chunk>();
+  active = 0;
+  size = 0;
+}
+
+size_t HighsCoefficientStore::AllocatedBytes() const {
+  return Capacity() * (2 * sizeof(int) + sizeof(double)) +
+         chunks.capacity() * sizeof(Chunk);
+}
+
+void AssembleColwiseMatrix(HighsInt num_col,
+                           const HighsCoefficientStore &coefficients,
+                           HighsColwiseMatrix &result, size_t num_threads) {
+  AssembleColwise(num_col, coefficients.Size(), StoreSource{coefficients},
+                  result, num_threads);
+}
+
+void AssembleRowwiseMatrix(HighsInt first_row, HighsInt num_row,
+                           const HighsCoefficientStore &coefficients,
+                           size_t begin, HighsColwiseMatrix &result) {
+  TransposedStoreSource source{coefficients, begin, first_row};
+  AssembleColwise(num_row, source.NumUnits(), source, result, 1);
+}
+
+void AssembleColwiseMatrix(HighsInt num_col, const int *row_index,
+                           const int *col_index, const double *value,
+                           size_t nnz, HighsColwiseMatrix &result,
+                           size_t num_threads) {
+  AssembleColwise(num_col, nnz,
+                  TripletSource{row_index, col_index, value, nnz}, result,
+                  num_threads);
+}
+
+} // namespace duckdb
@@ -0,0 +1,183 @@
+#include "highs_memory.hpp"
+#include "highs_model.hpp"
+#include "highs_snapshot.hpp"
+#include "duckdb/common/file_system.hpp"
+#include "duckdb/common/types/uuid.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+
+#include <mutex>
+#include <stdexcept>
+
+namespace duckdb {
+
+HighsMemoryCharge::~HighsMemoryCharge() { Release(); }
+
+HighsMemoryCharge::HighsMemoryCharge(HighsMemoryCharge &&other) noexcept
+    : db(std::move(other.db)), bytes(other.bytes) {
+  other.bytes = 0;
+}
+
+HighsMemoryCharge &
+HighsMemoryCharge::operator=(HighsMemoryCharge &&other) noexcept {
+  if (this != &other) {
+    Release();
+    db = std::move(other.db);
+    bytes = other.bytes;
+    other.bytes = 0;
+  }
+  return *this;
+}
+
+void HighsMemoryCharge::Release() noexcept {
+  auto instance = db.lock();
+  if (instance && bytes > 0) {
+    BufferManager::GetBufferManager(*instance).FreeReservedMemory(bytes);
+  }
+  bytes = 0;
+}
+
+void HighsMemoryCharge::Attach(ClientContext &context) {
+  if (db.lock() == context.db) {
+    return;
+  }
+  idx_t charged = bytes;
+  Release();
+  db = context.db;
+  Resize(charged);
+}
+
+void HighsMemoryCharge::Attach(const HighsMemoryCharge &other) {
+  if (db.lock() == other.db.lock()) {
+    return;
+  }
+  idx_t charged = bytes;
+  Release();
+  db = other.db;
+  Resize(charged);
+}
+
+void HighsMemoryCharge::Resize(idx_t new_bytes) {
+  auto instance = db.lock();
+  if (!instance) {
+    bytes = 0;
+    return;
+  }
+  auto &buffer_manager = BufferManager::GetBufferManager(*instance);
+  if (new_bytes > bytes) {
+    buffer_manager.ReserveMemory(new_bytes - bytes);
+  } else if (new_bytes < bytes) {
+    buffer_manager.FreeReservedMemory(bytes - new_bytes);
+  }
+  bytes = new_bytes;
+}
+
+idx_t EstimateSolveBytes(idx_t num_columns, idx_t num_rows,
+                         idx_t num_nonzeros) {
+  // Cost, bounds and integrality per column; bounds per row; the matrix
+  // column-wise and row-wise
+  idx_t lp = num_columns * (3 * sizeof(double) + sizeof(HighsVarType)) +
+             num_rows * 2 * sizeof(double) +
+             2 * (num_nonzeros * (sizeof(HighsInt) + sizeof(double)) +
+                  (num_columns + num_rows + 2) * sizeof(HighsInt));
+  // Primal and dual values, row slacks and one key per column and row
+  idx_t result = num_columns * 2 * sizeof(double) +
+                 num_rows * 3 * sizeof(double) +
+                 (num_columns + num_rows) * sizeof(string_t);
+  return lp + result;
+}
+
+void ChargeModelMemory(ClientContext &context, HighsModelInfo &model_info,
+                       idx_t extra_bytes) {
+  model_info.model_memory.Attach(context);
+  model_info.model_memory.Resize(model_info.ArrayBytes() + extra_bytes);
+}
+
+void ReserveModelVariables(ClientContext &context, HighsModelInfo &model_info,
+                           idx_t count) {
+  ChargeModelMemory(context, model_info,
+                    model_info.ReserveVariablesBytes(count));
+  model_info.ReserveVariables(count);
+}
+
+void ReserveModelConstraints(ClientContext &context,
+                             HighsModelInfo &model_info, idx_t count) {
+  ChargeModelMemory(context, model_info,
+                    model_info.ReserveConstraintsBytes(count));
+  model_info.ReserveConstraints(count);
+}
+
+idx_t SpillModel(FileSystem &fs, const std::string &directory,
+                 HighsModelInfo &model_info) {
+  // The solver and last result belong to solver_mutex. Solves take it
+  // before the model mutex, which is already held here, so only try it: a
+  // model being solved is not idle anyway.
+  std::unique_lock<std::timed_mutex> solver_guard(model_info.solver_mutex,
+                                                  std::try_to_lock);
+  if (!solver_guard.owns_lock()) {
+    throw std::runtime_error("Model is being solved");
+  }
+  if (!fs.DirectoryExists(directory)) {
+    fs.CreateDirectory(directory);
+  }
+  // Several processes may share a temp directory, so a counter would not do
+  std::string path = fs.JoinPath(
+      directory, "highs_spill_" + UUID::ToString(UUID::GenerateRandomUUID()) +
+                     ".snapshot");
+
+  // Keep the warm start, as highs_save_model does
+  HighsBasis basis = model_info.start_basis;
+  if (model_info.solver &&
+      model_info.synced_num_col == model_info.next_var_index &&
+      model_info.synced_num_row == model_info.next_constraint_index) {
+    basis = model_info.solver->getBasis();
+  }
+  SaveModelSnapshot(fs, path, model_info, &basis);
+
+  idx_t released =
+      model_info.model_memory.Bytes() + model_info.solver_memory.Bytes();
+  model_info.spilled_bytes = model_info.ArrayBytes();
+  model_info.spill_path = path;
+  model_info.Clear();
+  model_info.solver.reset();
+  model_info.last_result.reset();
+  model_info.model_memory.Resize(0);
+  model_info.solver_memory.Resize(0);
+  return released;
+}
+
+void RestoreSpilledModel(HighsModelInfo &model_info) {
+  std::lock_guard<HighsModelLock> guard(model_info.mutex);
+  if (!model_info.spilled) {
+    return; // restored by another lookup meanwhile
+  }
+  model_info.model_memory.Resize(model_info.spilled_bytes);
+  // Spill files are written to DuckDB's temp directory, which is local
+  auto fs = FileSystem::CreateLocal();
+  if (!fs->FileExists(model_info.spill_path)) {
+    // The registry outlives the database whose temp directory holds the
+    // file, and DuckDB removes that directory on close. The arrays are
+    // gone; keep the model usable, empty, rather than failing every lookup.
+    std::string path = model_info.spill_path;
+    model_info.model_memory.Resize(0);
+    model_info.spill_path.clear();
+    model_info.spilled = false;
+    throw std::runtime_error("Spill file " + path +
+                             " no longer exists; the model is now empty");
+  }
+  try {
+    LoadModelSnapshot(*fs, model_info.spill_path, model_info);
+  } catch (...) {
+    model_info.model_memory.Resize(0);
+    throw;
+  }
+  model_info.RebuildFingerprint();
+  try {
+    fs->RemoveFile(model_info.spill_path);
+  } catch (...) {
+    // A leftover file in the temp directory is harmless
+  }
+  model_info.spill_path.clear();
+  model_info.spilled = false;
+}
+
+} // namespace duckdb
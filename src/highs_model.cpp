@@ -0,0 +1,698 @@
+#include "highs_model.hpp"
+#include "highs_cache.hpp"
+#include "highs_matrix.hpp"
+#include "duckdb/common/file_system.hpp"
+#include "duckdb/common/types/hash.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <stdexcept>
+
+namespace duckdb {
+
+HighsVariableType ParseVariableType(const char *data, idx_t size) {
+  auto is = [&](const char *name) {
+    return size == std::strlen(name) && std::memcmp(data, name, size) == 0;
+  };
+  if (is("binary")) {
+    return HighsVariableType::BINARY;
+  }
+  if (is("integer")) {
+    return HighsVariableType::INTEGER;
+  }
+  return HighsVariableType::CONTINUOUS;
+}
+
+void SetIntegrality(const std::vector<HighsVariableType> &variable_types,
+                    HighsLp &lp) {
+  lp.integrality_.resize(variable_types.size());
+  for (size_t i = 0; i < variable_types.size(); i++) {
+    lp.integrality_[i] = ToHighsVarType(variable_types[i]);
+    if (variable_types[i] == HighsVariableType::BINARY) {
+      lp.col_lower_[i] = std::max(0.0, lp.col_lower_[i]);
+      lp.col_upper_[i] = std::min(1.0, lp.col_upper_[i]);
+    }
+  }
+}
+
+static void CheckStatus(HighsStatus status, const char *action) {
+  if (status == HighsStatus::kError) {
+    throw std::runtime_error(std::string("Failed to ") + action);
+  }
+}
+
+void HighsModelInfo::ClaimKeyType(HighsKeyType type,
+                                  const std::string &model_name) {
+  if (key_type == HighsKeyType::UNSET) {
+    key_type = type;
+  } else if (key_type != type) {
+    throw std::runtime_error(
+        "Model '" + model_name + "' is keyed by " +
+        (key_type == HighsKeyType::ID ? "BIGINT ids" : "names") +
+        ", not by " + (type == HighsKeyType::ID ? "BIGINT ids" : "names"));
+  }
+}
+
+void HighsModelInfo::Clear() {
+  key_type = HighsKeyType::UNSET;
+  variable_names = HighsNameTable();
+  constraint_names = HighsNameTable();
+  variable_ids = HighsIdMap();
+  constraint_ids = HighsIdMap();
+  obj_coefficients = std::vector<double>();
+  var_lower_bounds = std::vector<double>();
+  var_upper_bounds = std::vector<double>();
+  constraint_lower_bounds = std::vector<double>();
+  constraint_upper_bounds = std::vector<double>();
+  constraint_coefficients.Clear();
+  variable_types = std::vector<HighsVariableType>();
+  next_var_index = 0;
+  next_constraint_index = 0;
+  content_hash = 0;
+  content_check = 0;
+  model.lp_.sense_ = ObjSense::kMinimize;
+  model.lp_.offset_ = 0;
+  start_basis = HighsBasis();
+}
+
+// Fingerprint terms are tagged by kind so, say, a variable and a constraint
+// with the same index and values do not cancel out
+enum class FingerprintTag : uint64_t { VARIABLE = 1, CONSTRAINT, COEFFICIENT };
+
+static hash_t FingerprintTerm(FingerprintTag tag, uint64_t index) {
+  return Hash<uint64_t>(((uint64_t)tag << 56) ^ index);
+}
+
+// Add (sign +1) or remove (sign -1) a term in both content sums. The check
+// sum rehashes each term, so sets of terms whose plain sums coincide are
+// unlikely to coincide there as well.
+static void AccumulateTerm(uint64_t &sum, uint64_t &check, hash_t term,
+                           int sign) {
+  hash_t mixed = Hash<uint64_t>(term ^ 0x9e3779b97f4a7c15ULL);
+  sum += sign > 0 ? term : (uint64_t)0 - term;
+  check += sign > 0 ? mixed : (uint64_t)0 - mixed;
+}
+
+void HighsModelInfo::FingerprintVariable(int var_index, int sign) {
+  hash_t term = FingerprintTerm(FingerprintTag::VARIABLE, var_index);
+  term = CombineHash(term, Hash<double>(obj_coefficients[var_index]));
+  term = CombineHash(term, Hash<double>(var_lower_bounds[var_index]));
+  term = CombineHash(term, Hash<double>(var_upper_bounds[var_index]));
+  term = CombineHash(term, Hash<uint8_t>((uint8_t)variable_types[var_index]));
+  AccumulateTerm(content_hash, content_check, term, sign);
+}
+
+void HighsModelInfo::FingerprintConstraint(int constraint_index, int sign) {
+  hash_t term = FingerprintTerm(FingerprintTag::CONSTRAINT, constraint_index);
+  term = CombineHash(term,
+                     Hash<double>(constraint_lower_bounds[constraint_index]));
+  term = CombineHash(term,
+                     Hash<double>(constraint_upper_bounds[constraint_index]));
+  AccumulateTerm(content_hash, content_check, term, sign);
+}
+
+void HighsModelInfo::FingerprintCoefficient(int constraint_index,
+                                            int var_index, double value) {
+  uint64_t position = ((uint64_t)constraint_index << 32) | (uint32_t)var_index;
+  hash_t term = FingerprintTerm(FingerprintTag::COEFFICIENT, position);
+  AccumulateTerm(content_hash, content_check,
+                 CombineHash(term, Hash<double>(value)), 1);
+}
+
+void HighsModelInfo::RebuildFingerprint() {
+  content_hash = 0;
+  content_check = 0;
+  for (int col = 0; col < next_var_index; col++) {
+    FingerprintVariable(col, 1);
+  }
+  for (int row = 0; row < next_constraint_index; row++) {
+    FingerprintConstraint(row, 1);
+  }
+  constraint_coefficients.ForEach(
+      0, constraint_coefficients.Size(),
+      [&](int row, int col, double value) {
+        FingerprintCoefficient(row, col, value);
+      });
+}
+
+HighsFingerprint HighsModelInfo::Fingerprint() const {
+  HighsFingerprint fingerprint;
+  hash_t hash = CombineHash(Hash<uint64_t>(content_hash),
+                            Hash<int32_t>(next_var_index));
+  hash = CombineHash(hash, Hash<int32_t>(next_constraint_index));
+  hash = CombineHash(hash, Hash<int32_t>((int32_t)model.lp_.sense_));
+  hash = CombineHash(hash, Hash<double>(model.lp_.offset_));
+  // The check chains the same fields in another order from another seed
+  hash_t check = CombineHash(Hash<double>(model.lp_.offset_),
+                             Hash<uint64_t>(content_check));
+  check = CombineHash(check, Hash<int32_t>((int32_t)model.lp_.sense_));
+  for (auto &option : options) {
+    hash_t key = Hash(option.first.data(), option.first.size());
+    hash_t value = Hash(option.second.data(), option.second.size());
+    hash = CombineHash(hash, key);
+    hash = CombineHash(hash, value);
+    check = CombineHash(check, CombineHash(value, key));
+  }
+  fingerprint.hash = hash;
+  fingerprint.check = check;
+  fingerprint.num_columns = next_var_index;
+  fingerprint.num_rows = next_constraint_index;
+  fingerprint.num_nonzeros = constraint_coefficients.Size();
+  return fingerprint;
+}
+
+HighsModelInfo::~HighsModelInfo() {
+  if (spilled) {
+    try {
+      FileSystem::CreateLocal()->RemoveFile(spill_path);
+    } catch (...) {
+    }
+  }
+}
+
+static int64_t SteadyMilliseconds() {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+void HighsModelInfo::Touch() { last_used_ms = SteadyMilliseconds(); }
+
+double HighsModelInfo::IdleSeconds() const {
+  return (double)(SteadyMilliseconds() - last_used_ms) / 1000.0;
+}
+
+idx_t HighsModelInfo::ArrayBytes() const {
+  return variable_names.AllocatedBytes() + variable_ids.AllocatedBytes() +
+         constraint_names.AllocatedBytes() + constraint_ids.AllocatedBytes() +
+         (obj_coefficients.capacity() + var_lower_bounds.capacity() +
+          var_upper_bounds.capacity() + constraint_lower_bounds.capacity() +
+          constraint_upper_bounds.capacity()) *
+             sizeof(double) +
+         variable_types.capacity() * sizeof(HighsVariableType) +
+         constraint_coefficients.AllocatedBytes();
+}
+
+void HighsModelInfo::ReserveVariables(idx_t count) {
+  if (key_type == HighsKeyType::ID) {
+    variable_ids.Reserve(count);
+  } else {
+    variable_names.Reserve(count);
+  }
+  ReserveGrown(obj_coefficients, count);
+  ReserveGrown(var_lower_bounds, count);
+  ReserveGrown(var_upper_bounds, count);
+  ReserveGrown(variable_types, count);
+}
+
+void HighsModelInfo::ReserveConstraints(idx_t count) {
+  if (key_type == HighsKeyType::ID) {
+    constraint_ids.Reserve(count);
+  } else {
+    constraint_names.Reserve(count);
+  }
+  ReserveGrown(constraint_lower_bounds, count);
+  ReserveGrown(constraint_upper_bounds, count);
+}
+
+idx_t HighsModelInfo::ReserveVariablesBytes(idx_t count) const {
+  return (key_type == HighsKeyType::ID ? variable_ids.ReserveBytes(count)
+                                       : variable_names.ReserveBytes(count)) +
+         ReserveGrownBytes(obj_coefficients, count) +
+         ReserveGrownBytes(var_lower_bounds, count) +
+         ReserveGrownBytes(var_upper_bounds, count) +
+         ReserveGrownBytes(variable_types, count);
+}
+
+idx_t HighsModelInfo::ReserveConstraintsBytes(idx_t count) const {
+  return (key_type == HighsKeyType::ID
+              ? constraint_ids.ReserveBytes(count)
+              : constraint_names.ReserveBytes(count)) +
+         ReserveGrownBytes(constraint_lower_bounds, count) +
+         ReserveGrownBytes(constraint_upper_bounds, count);
+}
+
+void HighsKeySnapshot::SnapshotNames(const HighsNameTable &table) {
+  count = table.Size();
+  names = table.Names();
+  name_arena = table.Arena();
+  ids.clear();
+}
+
+void HighsKeySnapshot::SnapshotColumns(const HighsModelInfo &model_info) {
+  SnapshotNames(model_info.variable_names);
+  count = model_info.next_var_index;
+  ids = model_info.variable_ids.Ids();
+}
+
+void HighsKeySnapshot::SnapshotRows(const HighsModelInfo &model_info) {
+  SnapshotNames(model_info.constraint_names);
+  count = model_info.next_constraint_index;
+  ids = model_info.constraint_ids.Ids();
+}
+
+void HighsModelInfo::MarkVariableDirty(int var_index) {
+  // Anything the solver has not seen yet goes in with the next sync anyway
+  if (solver && var_index < synced_num_col) {
+    dirty_variables.push_back(var_index);
+  }
+}
+
+void HighsModelInfo::MarkConstraintDirty(int constraint_index) {
+  if (solver && constraint_index < synced_num_row) {
+    dirty_constraints.push_back(constraint_index);
+  }
+}
+
+HighsLp HighsModelInfo::AssembleLp(size_t num_threads) const {
+  HighsLp lp;
+  lp.sense_ = model.lp_.sense_;
+  lp.offset_ = model.lp_.offset_;
+  lp.num_col_ = next_var_index;
+  lp.num_row_ = next_constraint_index;
+  lp.col_cost_ = obj_coefficients;
+  lp.col_lower_ = var_lower_bounds;
+  lp.col_upper_ = var_upper_bounds;
+  lp.row_lower_ = constraint_lower_bounds;
+  lp.row_upper_ = constraint_upper_bounds;
+
+  // Build constraint matrix in column-wise format
+  HighsColwiseMatrix matrix;
+  AssembleColwiseMatrix(next_var_index, constraint_coefficients, matrix,
+                        num_threads);
+  lp.a_matrix_.format_ = MatrixFormat::kColwise;
+  lp.a_matrix_.num_col_ = next_var_index;
+  lp.a_matrix_.num_row_ = next_constraint_index;
+  lp.a_matrix_.start_ = std::move(matrix.start);
+  lp.a_matrix_.index_ = std::move(matrix.index);
+  lp.a_matrix_.value_ = std::move(matrix.value);
+
+  // Configure integer/binary variables
+  SetIntegrality(variable_types, lp);
+  return lp;
+}
+
+void HighsModelInfo::BuildSolver(size_t num_threads,
+                                 HighsSolveProfile *profile) {
+  // The assembled LP lives next to HiGHS's copy until passModel returns
+  HighsMemoryCharge scratch;
+  scratch.Attach(model_memory);
+  scratch.Resize(EstimateSolveBytes(next_var_index, next_constraint_index,
+                                    constraint_coefficients.Size()));
+  HighsStopwatch assembly;
+  HighsLp lp = AssembleLp(num_threads);
+  HighsStopwatch pass_model;
+  if (profile) {
+    profile->assembly_time = assembly.Seconds();
+  }
+
+  auto highs = make_uniq<Highs>();
+  if (highs->passModel(std::move(lp)) != HighsStatus::kOk) {
+    throw std::runtime_error("Failed to pass model to HiGHS");
+  }
+  if (start_basis.valid) {
+    // A stale basis only costs the warm start, so its status is ignored
+    highs->setBasis(start_basis);
+    start_basis = HighsBasis();
+  }
+  solver = std::move(highs);
+  if (profile) {
+    profile->pass_model_time = pass_model.Seconds();
+  }
+
+  synced_num_col = next_var_index;
+  synced_num_row = next_constraint_index;
+  synced_nnz = constraint_coefficients.Size();
+  dirty_variables.clear();
+  dirty_constraints.clear();
+}
+
+void HighsModelInfo::ApplyDeltas() {
+  Highs &highs = *solver;
+
+  // New variables first, so new coefficients can refer to them
+  if (next_var_index > synced_num_col) {
+    HighsInt first = synced_num_col;
+    HighsInt count = next_var_index - synced_num_col;
+    std::vector<double> lower(var_lower_bounds.begin() + first,
+                              var_lower_bounds.end());
+    std::vector<double> upper(var_upper_bounds.begin() + first,
+                              var_upper_bounds.end());
+    std::vector<HighsVarType> integrality(count);
+    bool any_integer = false;
+    for (HighsInt i = 0; i < count; i++) {
+      HighsVariableType var_type = variable_types[first + i];
+      integrality[i] = ToHighsVarType(var_type);
+      any_integer |= integrality[i] == HighsVarType::kInteger;
+      if (var_type == HighsVariableType::BINARY) {
+        lower[i] = std::max(0.0, lower[i]);
+        upper[i] = std::min(1.0, upper[i]);
+      }
+    }
+    CheckStatus(highs.addCols(count, obj_coefficients.data() + first,
+                              lower.data(), upper.data(), 0, nullptr, nullptr,
+                              nullptr),
+                "add variables to HiGHS");
+    if (any_integer) {
+      CheckStatus(highs.changeColsIntegrality(first, next_var_index - 1,
+                                              integrality.data()),
+                  "set variable integrality in HiGHS");
+    }
+    synced_num_col = next_var_index;
+  }
+
+  // Coefficients appended since the last sync: those of constraints the
+  // solver already has are added onto the current matrix entry
+  size_t nnz = constraint_coefficients.Size();
+  constraint_coefficients.ForEach(
+      synced_nnz, nnz, [&](int row, int col, double value) {
+        if (row >= synced_num_row) {
+          return;
+        }
+        double current = 0.0;
+        CheckStatus(highs.getCoeff(row, col, current),
+                    "read coefficient from HiGHS");
+        CheckStatus(highs.changeCoeff(row, col, current + value),
+                    "change coefficient in HiGHS");
+      });
+
+  // and new constraints go in with all of theirs, sorted by column with
+  // duplicates summed as HiGHS expects for addRows
+  if (next_constraint_index > synced_num_row) {
+    HighsInt first = synced_num_row;
+    HighsInt count = next_constraint_index - synced_num_row;
+    HighsColwiseMatrix rows;
+    AssembleRowwiseMatrix(first, count, constraint_coefficients, synced_nnz,
+                          rows);
+    CheckStatus(highs.addRows(count, constraint_lower_bounds.data() + first,
+                              constraint_upper_bounds.data() + first,
+                              (HighsInt)rows.index.size(), rows.start.data(),
+                              rows.index.data(), rows.value.data()),
+                "add constraints to HiGHS");
+    synced_num_row = next_constraint_index;
+  }
+  synced_nnz = nnz;
+
+  // In-place bound and cost edits
+  for (int col : dirty_variables) {
+    double lower = var_lower_bounds[col];
+    double upper = var_upper_bounds[col];
+    if (variable_types[col] == HighsVariableType::BINARY) {
+      lower = std::max(0.0, lower);
+      upper = std::min(1.0, upper);
+    }
+    CheckStatus(highs.changeColBounds(col, lower, upper),
+                "change variable bounds in HiGHS");
+    CheckStatus(highs.changeColCost(col, obj_coefficients[col]),
+                "change objective coefficient in HiGHS");
+  }
+  dirty_variables.clear();
+  for (int row : dirty_constraints) {
+    CheckStatus(highs.changeRowBounds(row, constraint_lower_bounds[row],
+                                      constraint_upper_bounds[row]),
+                "change constraint bounds in HiGHS");
+  }
+  dirty_constraints.clear();
+}
+
+Highs &HighsModelInfo::SyncSolver(size_t num_threads,
+                                  HighsSolveProfile *profile) {
+  if (!solver) {
+    BuildSolver(num_threads, profile);
+    return *solver;
+  }
+  HighsStopwatch deltas;
+
+  // HiGHS keeps the simplex basis across model edits; a MIP instead gets
+  // the previous incumbent back as a starting solution
+  std::vector<double> incumbent;
+  if (solver->getLp().isMip() && solver->getSolution().value_valid) {
+    incumbent = solver->getSolution().col_value;
+  }
+
+  ApplyDeltas();
+
+  if (!incumbent.empty()) {
+    HighsSolution start;
+    start.col_value = std::move(incumbent);
+    for (int col = (int)start.col_value.size(); col < synced_num_col; col++) {
+      start.col_value.push_back(std::min(
+          std::max(0.0, var_lower_bounds[col]), var_upper_bounds[col]));
+    }
+    start.value_valid = true;
+    solver->setSolution(start);
+  }
+  // Nothing is assembled; the deltas are the model going into HiGHS
+  if (profile) {
+    profile->assembly_time = 0.0;
+    profile->pass_model_time = deltas.Seconds();
+  }
+  return *solver;
+}
+
+void RunHighs(Highs &highs, HighsSolveResult &result) {
+  HighsStatus status = highs.run();
+  if (status == HighsStatus::kError) {
+    throw std::runtime_error("Failed to solve model");
+  }
+
+  // Get solution. Without one these are empty; report zeros throughout.
+  const HighsSolution &solution = highs.getSolution();
+  result.col_value = solution.col_value;
+  result.col_dual = solution.col_dual;
+  result.row_value = solution.row_value;
+  result.row_dual = solution.row_dual;
+  result.col_value.resize(result.columns.count, 0.0);
+  result.col_dual.resize(result.columns.count, 0.0);
+  result.row_value.resize(result.rows.count, 0.0);
+  result.row_dual.resize(result.rows.count, 0.0);
+
+  const HighsLp &lp = highs.getLp();
+  result.row_slack.resize(result.rows.count);
+  for (idx_t row = 0; row < result.rows.count; row++) {
+    double activity = result.row_value[row];
+    double slack = kHighsInf;
+    if (row < lp.row_upper_.size() && lp.row_upper_[row] < kHighsInf) {
+      slack = lp.row_upper_[row] - activity;
+    }
+    if (row < lp.row_lower_.size() && lp.row_lower_[row] > -kHighsInf) {
+      slack = std::min(slack, activity - lp.row_lower_[row]);
+    }
+    result.row_slack[row] = slack;
+  }
+
+  result.model_status = highs.getModelStatus();
+  result.objective_value = highs.getInfo().objective_function_value;
+}
+
+std::unique_lock<std::timed_mutex> LockSolver(HighsModelInfo &model_info,
+                                              const HighsRunMonitor *monitor) {
+  std::unique_lock<std::timed_mutex> guard(model_info.solver_mutex,
+                                           std::defer_lock);
+  if (!monitor) {
+    guard.lock();
+    return guard;
+  }
+  while (!guard.try_lock_for(std::chrono::milliseconds(50))) {
+    if (monitor->CancelRequested()) {
+      throw InterruptException();
+    }
+  }
+  return guard;
+}
+
+// Run a solver synced to the model state the result's keys were taken
+// from, under the monitor; record the run in the solve log and, unless it
+// was interrupted, keep the result as the model's last and in the cache.
+// The caller holds solver_mutex but not the model mutex.
+static void RunAndPublish(HighsModelInfo &model_info,
+                          const HighsThreadSettings &settings, Highs &highs,
+                          const HighsOptionProfile &options,
+                          const HighsFingerprint &fingerprint,
+                          HighsRunMonitor *monitor, HighsSolveProfile profile,
+                          const std::shared_ptr<HighsSolveResult> &result) {
+  ApplyHighsOptions(highs, options);
+  HighsSolveSlot slot(settings, highs, options);
+  // Always watched, as the first solver callback marks the end of presolve
+  HighsRunMonitor own_monitor;
+  if (!monitor) {
+    monitor = &own_monitor;
+  }
+  monitor->Start(result->columns.count, result->rows.count,
+                 highs.getOptions().time_limit);
+  {
+    HighsMonitorScope scope(highs, *monitor);
+    HighsStopwatch run;
+    RunHighs(highs, *result);
+    RecordRunProfile(highs, *monitor, run.Seconds(), profile);
+  }
+  profile.model_status = result->model_status;
+  profile.objective_value = result->objective_value;
+  result->solve_id = model_info.solve_log.Record(std::move(profile));
+  if (result->model_status != HighsModelStatus::kInterrupt) {
+    model_info.last_result = result;
+    HighsResultCache::Instance().Insert(fingerprint, result);
+  }
+}
+
+std::shared_ptr<const HighsSolveResult>
+SolveModel(HighsModelInfo &model_info, const HighsThreadSettings &settings,
+           HighsRunMonitor *monitor) {
+  // Reuse the model's live solver, sending it only what changed since the
+  // previous solve. Loaders are only held off while the deltas go in; the
+  // run itself just needs the solver.
+  auto solver_guard = LockSolver(model_info, monitor);
+  auto &cache = HighsResultCache::Instance();
+  auto result = std::make_shared<HighsSolveResult>();
+  HighsSolveProfile profile;
+  HighsOptionProfile options;
+  HighsFingerprint fingerprint;
+  Highs *highs;
+  {
+    HighsSharedLock guard(model_info.mutex);
+    uint64_t version = model_info.mutex.Version();
+    if (model_info.last_result &&
+        model_info.last_result->model_version == version) {
+      return model_info.last_result;
+    }
+    // Charge what the solver and result will hold before building them, so
+    // a solve too large for memory_limit fails instead of the process
+    model_info.solver_memory.Attach(model_info.model_memory);
+    model_info.solver_memory.Resize(EstimateSolveBytes(
+        model_info.next_var_index, model_info.next_constraint_index,
+        model_info.constraint_coefficients.Size()));
+    fingerprint = model_info.Fingerprint();
+    auto cached = cache.Lookup(fingerprint);
+    if (cached) {
+      // Same LP and options as an earlier solve, possibly of another
+      // model: reuse its values under this model's keys
+      *result = *cached;
+      result->model_version = version;
+      result->columns.SnapshotColumns(model_info);
+      result->rows.SnapshotRows(model_info);
+      profile.source = "cache";
+      profile.model_status = result->model_status;
+      profile.objective_value = result->objective_value;
+      result->solve_id = model_info.solve_log.Record(std::move(profile));
+      model_info.last_result = result;
+      return std::move(result);
+    }
+    highs = &model_info.SyncSolver(
+        HighsSolveWidth(settings, model_info.options), &profile);
+    result->model_version = version;
+    result->columns.SnapshotColumns(model_info);
+    result->rows.SnapshotRows(model_info);
+    options = model_info.options;
+  }
+  RunAndPublish(model_info, settings, *highs, options, fingerprint, monitor,
+                std::move(profile), result);
+  return std::move(result);
+}
+
+HighsRangingResult RangeModel(HighsModelInfo &model_info,
+                              const HighsThreadSettings &settings,
+                              HighsRunMonitor *monitor) {
+  auto solver_guard = LockSolver(model_info, monitor);
+  auto solve = std::make_shared<HighsSolveResult>();
+  HighsSolveProfile profile;
+  HighsOptionProfile options;
+  HighsFingerprint fingerprint;
+  Highs *highs;
+  {
+    HighsSharedLock guard(model_info.mutex);
+    model_info.solver_memory.Attach(model_info.model_memory);
+    model_info.solver_memory.Resize(EstimateSolveBytes(
+        model_info.next_var_index, model_info.next_constraint_index,
+        model_info.constraint_coefficients.Size()));
+    // Without deltas to apply this leaves the solver's basis alone
+    highs = &model_info.SyncSolver(
+        HighsSolveWidth(settings, model_info.options), &profile);
+    solve->model_version = model_info.mutex.Version();
+    solve->columns.SnapshotColumns(model_info);
+    solve->rows.SnapshotRows(model_info);
+    fingerprint = model_info.Fingerprint();
+    options = model_info.options;
+  }
+  if (highs->getLp().isMip()) {
+    throw std::runtime_error(
+        "Ranging is only defined for LPs; the model has integer variables");
+  }
+
+  if (highs->getModelStatus() != HighsModelStatus::kOptimal ||
+      !highs->getBasis().valid) {
+    // A full solve of the model as it is, so later solves can reuse it
+    profile.source = "ranging";
+    RunAndPublish(model_info, settings, *highs, options, fingerprint, monitor,
+                  std::move(profile), solve);
+  }
+
+  HighsRangingResult result;
+  result.columns = solve->columns;
+  result.rows = solve->rows;
+  result.model_status = highs->getModelStatus();
+  result.objective_value = highs->getInfo().objective_function_value;
+  if (result.model_status != HighsModelStatus::kOptimal) {
+    return result;
+  }
+  if (!highs->getBasis().valid) {
+    throw std::runtime_error("Ranging needs a simplex basis; solve with "
+                             "crossover on when using the IPM solver");
+  }
+  if (highs->getRanging(result.ranging) == HighsStatus::kError) {
+    throw std::runtime_error("Failed to compute ranging");
+  }
+  const HighsSolution &solution = highs->getSolution();
+  result.col_value = solution.col_value;
+  result.row_value = solution.row_value;
+  result.col_value.resize(result.columns.count, 0.0);
+  result.row_value.resize(result.rows.count, 0.0);
+  return result;
+}
+
+std::vector<std::pair<std::string, std::shared_ptr<HighsModelInfo>>>
+HighsModelRegistry::List() {
+  std::vector<std::pair<std::string, std::shared_ptr<HighsModelInfo>>> models;
+  for (auto &shard : shards) {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    for (auto &entry : shard.models) {
+      models.emplace_back(entry.first, entry.second);
+    }
+  }
+  return models;
+}
+
+void HighsModelRegistry::SpillIdleModels(
+    double idle_seconds,
+    const std::function<void(const std::string &, HighsModelInfo &)> &spill) {
+  for (auto &shard : shards) {
+    std::vector<std::pair<std::string, std::shared_ptr<HighsModelInfo>>>
+        claimed;
+    {
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      for (auto &entry : shard.models) {
+        auto &model = entry.second;
+        // Held by the registry alone, nobody can be using the model, and
+        // nobody can start to before the shard is unlocked
+        if (model.use_count() != 1 || model->spilled ||
+            model->IdleSeconds() < idle_seconds) {
+          continue;
+        }
+        model->spilled = true;
+        model->mutex.lock();
+        claimed.emplace_back(entry.first, model);
+      }
+    }
+    for (auto &entry : claimed) {
+      auto &model = *entry.second;
+      try {
+        spill(entry.first, model);
+      } catch (...) {
+        model.spilled = false;
+      }
+      model.mutex.unlock();
+    }
+  }
+}
+
+} // namespace duckdb
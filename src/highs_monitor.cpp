@@ -0,0 +1,139 @@
+#include "highs_monitor.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace duckdb {
+
+namespace {
+
+const int kMonitoredCallbacks[] = {
+    kCallbackSimplexInterrupt, kCallbackIpmInterrupt, kCallbackMipInterrupt,
+    kCallbackMipImprovingSolution};
+
+// The incumbent arrives as a vector or a raw array depending on the HiGHS
+// release
+std::vector<double> CopySolution(const std::vector<double> &values,
+                                 idx_t count) {
+  return values;
+}
+
+std::vector<double> CopySolution(const double *values, idx_t count) {
+  return values ? std::vector<double>(values, values + count)
+                : std::vector<double>();
+}
+
+// HiGHS callback forwarding to a monitor. The data types are template
+// parameters so the functor fits the callback signature of any HiGHS
+// release that has these fields.
+struct HighsMonitorCallback {
+  HighsRunMonitor *monitor;
+
+  template <class DATA_OUT, class DATA_IN>
+  void operator()(int callback_type, const std::string &message,
+                  const DATA_OUT *data_out, DATA_IN *data_in,
+                  void *user_data) const {
+    monitor->ReportSolverActivity();
+    if (callback_type == kCallbackMipImprovingSolution) {
+      monitor->ReportIncumbent(data_out->objective_function_value);
+      monitor->ReportGap(data_out->mip_gap);
+      monitor->ReportIterations(data_out->simplex_iteration_count,
+                                data_out->running_time);
+      if (monitor->WantsSolutions()) {
+        monitor->ReportSolution(
+            CopySolution(data_out->mip_solution, monitor->NumColumns()));
+      }
+      return;
+    }
+    if (callback_type == kCallbackMipInterrupt) {
+      monitor->ReportGap(data_out->mip_gap);
+    }
+    monitor->ReportIterations(data_out->simplex_iteration_count,
+                              data_out->running_time);
+    if (data_in && monitor->CancelRequested()) {
+      data_in->user_interrupt = true;
+    }
+  }
+};
+
+} // namespace
+
+HighsRunMonitor::HighsRunMonitor()
+    : objective(std::numeric_limits<double>::quiet_NaN()),
+      gap(std::numeric_limits<double>::quiet_NaN()), time_limit(kHighsInf),
+      solver_started(std::numeric_limits<double>::quiet_NaN()) {}
+
+void HighsRunMonitor::Start(idx_t num_columns, idx_t num_rows,
+                            double time_limit_seconds) {
+  columns = num_columns;
+  rows = num_rows;
+  time_limit = time_limit_seconds;
+  start_time = std::chrono::steady_clock::now();
+  solver_started = std::numeric_limits<double>::quiet_NaN();
+}
+
+void HighsRunMonitor::ReportSolverActivity() {
+  // Only the first callback takes the time
+  if (std::isnan(solver_started.load(std::memory_order_relaxed))) {
+    solver_started = std::chrono::duration<double>(
+                         std::chrono::steady_clock::now() - start_time)
+                         .count();
+  }
+}
+
+double HighsRunMonitor::Progress() const {
+  double progress = 0;
+  double current_gap = gap;
+  if (!std::isnan(current_gap)) {
+    // The gap starts near 1 and closes to 0
+    progress = 1 - std::min(1.0, current_gap);
+  } else {
+    double done = (double)iterations.load();
+    double expected = 2.0 * (double)MaxValue<idx_t>(1, rows);
+    progress = done / (done + expected);
+  }
+  double limit = time_limit;
+  if (limit > 0 && limit < kHighsInf) {
+    progress = std::max(progress, std::min(1.0, elapsed / limit));
+  }
+  return progress;
+}
+
+void HighsRunMonitor::ReportIncumbent(double objective_value) {
+  objective = objective_value;
+}
+
+void HighsRunMonitor::ReportSolution(std::vector<double> values) {
+  solution_listener(objective, gap, elapsed, std::move(values));
+}
+
+void HighsRunMonitor::ReportIterations(int64_t simplex_iterations,
+                                       double running_time) {
+  iterations = simplex_iterations;
+  elapsed = running_time;
+}
+
+void HighsRunMonitor::ReportGap(double mip_gap) {
+  // HiGHS reports an infinite gap until it has both bounds
+  if (mip_gap < kHighsInf) {
+    gap = mip_gap;
+  }
+}
+
+HighsMonitorScope::HighsMonitorScope(Highs &highs, HighsRunMonitor &monitor)
+    : highs(highs) {
+  highs.setCallback(HighsCallbackFunctionType(HighsMonitorCallback{&monitor}));
+  for (int callback_type : kMonitoredCallbacks) {
+    highs.startCallback(callback_type);
+  }
+}
+
+HighsMonitorScope::~HighsMonitorScope() {
+  for (int callback_type : kMonitoredCallbacks) {
+    highs.stopCallback(callback_type);
+  }
+  highs.setCallback(HighsCallbackFunctionType());
+}
+
+} // namespace duckdb
@@ -0,0 +1,705 @@
+#include "highs_mps.hpp"
+#include "highs_matrix.hpp"
+#include "highs_memory.hpp"
+#include "duckdb/common/file_system.hpp"
+#include "duckdb/common/string_util.hpp"
+
+#include <cctype>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <unordered_set>
+
+namespace duckdb {
+
+namespace {
+
+// Hands out the lines of a file one at a time from a fixed-size buffer.
+// Lines are NUL-terminated in place and stay valid until the next call.
+class MpsLineReader {
+public:
+  MpsLineReader(FileHandle &handle) : handle(handle), buffer(kBufferSize) {}
+
+  // The next line, or nullptr at the end of the file
+  char *Next() {
+    while (true) {
+      char *start = buffer.data() + position;
+      char *newline = (char *)std::memchr(start, '\n', size - position);
+      if (newline) {
+        *newline = '\0';
+        position = newline + 1 - buffer.data();
+        line_number++;
+        return start;
+      }
+      if (eof) {
+        if (position == size) {
+          return nullptr;
+        }
+        // Last line without a newline
+        buffer[size] = '\0';
+        position = size;
+        line_number++;
+        return start;
+      }
+      Refill();
+    }
+  }
+
+  idx_t LineNumber() const { return line_number; }
+
+private:
+  static constexpr idx_t kBufferSize = 1 << 20;
+
+  void Refill() {
+    // Move the partial line to the front, then top the buffer up
+    idx_t remaining = size - position;
+    if (remaining + 1 >= buffer.size()) {
+      buffer.resize(buffer.size() * 2);
+    }
+    std::memmove(buffer.data(), buffer.data() + position, remaining);
+    position = 0;
+    size = remaining;
+    auto read = handle.Read(buffer.data() + size, buffer.size() - size - 1);
+    if (read <= 0) {
+      eof = true;
+    } else {
+      size += (idx_t)read;
+    }
+  }
+
+  FileHandle &handle;
+  std::vector<char> buffer;
+  idx_t position = 0;
+  idx_t size = 0;
+  idx_t line_number = 0;
+  bool eof = false;
+};
+
+// Split a line on whitespace in place; returns the number of tokens
+idx_t Tokenize(char *line, char *tokens[], idx_t max_tokens) {
+  idx_t count = 0;
+  char *p = line;
+  while (*p && count < max_tokens) {
+    while (*p == ' ' || *p == '\t' || *p == '\r') {
+      p++;
+    }
+    if (!*p) {
+      break;
+    }
+    tokens[count++] = p;
+    while (*p && *p != ' ' && *p != '\t' && *p != '\r') {
+      p++;
+    }
+    if (*p) {
+      *p++ = '\0';
+    }
+  }
+  return count;
+}
+
+enum class MpsSection : uint8_t {
+  NONE,
+  OBJSENSE,
+  ROWS,
+  COLUMNS,
+  RHS,
+  RANGES,
+  BOUNDS,
+  END
+};
+
+// Rows, columns and coefficients are charged to the database as the model
+// arrays grow, before each growth is allocated, as the bulk loaders do; a
+// file too large for memory_limit fails partway through instead of once it
+// is all in memory.
+struct MpsParser {
+  MpsParser(ClientContext &context, MpsLineReader &reader,
+            HighsModelInfo &model_info)
+      : context(context), reader(reader), model_info(model_info) {}
+
+  ClientContext &context;
+  MpsLineReader &reader;
+  HighsModelInfo &model_info;
+
+  MpsSection section = MpsSection::NONE;
+  std::string objective_row;
+  std::vector<char> row_types; // N for free rows after the objective
+  std::vector<double> rhs;
+  std::vector<double> ranges;
+  std::vector<bool> has_range;
+  bool integer_columns = false;
+  int current_column = -1;
+  idx_t num_nonzeros = 0;
+
+  [[noreturn]] void Error(const std::string &message) {
+    throw std::runtime_error("MPS line " +
+                             std::to_string(reader.LineNumber()) + ": " +
+                             message);
+  }
+
+  double ParseNumber(const char *token) {
+    char *end;
+    double value = std::strtod(token, &end);
+    if (end == token || *end) {
+      Error("invalid number '" + std::string(token) + "'");
+    }
+    return value;
+  }
+
+  // Row index of a name, -1 for the objective
+  int FindRow(const char *name) {
+    if (objective_row == name) {
+      return -1;
+    }
+    int row = model_info.constraint_names.Find(name, std::strlen(name));
+    if (row < 0) {
+      Error("unknown row '" + std::string(name) + "'");
+    }
+    return row;
+  }
+
+  int FindColumn(const char *name) {
+    int col = model_info.variable_names.Find(name, std::strlen(name));
+    if (col < 0) {
+      Error("unknown column '" + std::string(name) + "'");
+    }
+    return col;
+  }
+
+  void StartSection(char *tokens[], idx_t count) {
+    std::string name = StringUtil::Upper(tokens[0]);
+    if (name == "NAME") {
+      section = MpsSection::NONE;
+    } else if (name == "OBJSENSE") {
+      section = MpsSection::OBJSENSE;
+      if (count > 1) {
+        ParseSense(tokens[1]);
+      }
+    } else if (name == "ROWS") {
+      section = MpsSection::ROWS;
+    } else if (name == "COLUMNS") {
+      section = MpsSection::COLUMNS;
+    } else if (name == "RHS") {
+      section = MpsSection::RHS;
+    } else if (name == "RANGES") {
+      section = MpsSection::RANGES;
+    } else if (name == "BOUNDS") {
+      section = MpsSection::BOUNDS;
+    } else if (name == "ENDATA") {
+      section = MpsSection::END;
+    } else {
+      Error("unsupported section '" + name + "'");
+    }
+  }
+
+  void ParseSense(const char *token) {
+    std::string sense = StringUtil::Upper(token);
+    if (sense == "MAX" || sense == "MAXIMIZE") {
+      model_info.model.lp_.sense_ = ObjSense::kMaximize;
+    } else if (sense == "MIN" || sense == "MINIMIZE") {
+      model_info.model.lp_.sense_ = ObjSense::kMinimize;
+    } else {
+      Error("invalid OBJSENSE '" + sense + "'");
+    }
+  }
+
+  void ParseRow(char *tokens[], idx_t count) {
+    if (count != 2) {
+      Error("expected a row type and name");
+    }
+    char type = (char)std::toupper(tokens[0][0]);
+    // The first N row is the objective; later ones are kept as free
+    // constraints, so models written with free rows read back unchanged
+    if (type == 'N' && objective_row.empty()) {
+      objective_row = tokens[1];
+      return;
+    }
+    if (type != 'N' && type != 'L' && type != 'G' && type != 'E') {
+      Error("invalid row type '" + std::string(tokens[0]) + "'");
+    }
+    // Row bounds are filled in at the end, but their room is taken here
+    idx_t num_rows = model_info.constraint_names.Size();
+    if (num_rows == model_info.constraint_lower_bounds.capacity()) {
+      ReserveModelConstraints(context, model_info, num_rows + 1);
+    }
+    if (model_info.constraint_names.Insert(tokens[1],
+                                           std::strlen(tokens[1])) < 0) {
+      Error("duplicate row '" + std::string(tokens[1]) + "'");
+    }
+    row_types.push_back(type);
+  }
+
+  void ParseColumn(char *tokens[], idx_t count) {
+    if (count >= 3 && std::strcmp(tokens[1], "'MARKER'") == 0) {
+      if (std::strcmp(tokens[2], "'INTORG'") == 0) {
+        integer_columns = true;
+      } else if (std::strcmp(tokens[2], "'INTEND'") == 0) {
+        integer_columns = false;
+      } else {
+        Error("invalid marker '" + std::string(tokens[2]) + "'");
+      }
+      return;
+    }
+    if (count != 3 && count != 5) {
+      Error("expected a column name and one or two row entries");
+    }
+    if (current_column < 0 ||
+        model_info.variable_names.Get(current_column).GetString() !=
+            tokens[0]) {
+      idx_t num_columns = model_info.obj_coefficients.size();
+      if (num_columns == model_info.obj_coefficients.capacity()) {
+        ReserveModelVariables(context, model_info, num_columns + 1);
+      }
+      current_column = model_info.variable_names.Insert(
+          tokens[0], std::strlen(tokens[0]));
+      if (current_column < 0) {
+        Error("column '" + std::string(tokens[0]) +
+              "' is not contiguous");
+      }
+      model_info.obj_coefficients.push_back(0.0);
+      model_info.var_lower_bounds.push_back(0.0);
+      model_info.var_upper_bounds.push_back(kHighsInf);
+      // Integer columns without bounds are binary, as in HiGHS
+      model_info.variable_types.push_back(integer_columns
+                                              ? HighsVariableType::BINARY
+                                              : HighsVariableType::CONTINUOUS);
+    }
+    for (idx_t i = 1; i + 1 < count; i += 2) {
+      int row = FindRow(tokens[i]);
+      double value = ParseNumber(tokens[i + 1]);
+      if (row == -1) {
+        model_info.obj_coefficients[current_column] = value;
+      } else {
+        auto &coefficients = model_info.constraint_coefficients;
+        size_t chunk_bytes = coefficients.ReserveBytes(1);
+        if (chunk_bytes > 0) {
+          ChargeModelMemory(context, model_info, chunk_bytes);
+          coefficients.Reserve(1);
+        }
+        coefficients.Append(row, current_column, value);
+        num_nonzeros++;
+      }
+    }
+  }
+
+  // RHS and RANGES lines: [set name] (row value)+
+  void ParseRowValues(char *tokens[], idx_t count, bool range) {
+    idx_t first = count % 2 == 1 ? 1 : 0;
+    if (count < 2) {
+      Error("expected row entries");
+    }
+    for (idx_t i = first; i + 1 < count; i += 2) {
+      int row = FindRow(tokens[i]);
+      double value = ParseNumber(tokens[i + 1]);
+      if (row == -1 && !range) {
+        // A right-hand side on the objective is minus its constant
+        model_info.model.lp_.offset_ = -value;
+      } else if (row >= 0 && range) {
+        ranges[row] = value;
+        has_range[row] = true;
+      } else if (row >= 0) {
+        rhs[row] = value;
+      }
+    }
+  }
+
+  void ParseBound(char *tokens[], idx_t count) {
+    if (count < 2) {
+      Error("expected a bound type and column");
+    }
+    std::string type = StringUtil::Upper(tokens[0]);
+    bool needs_value = type == "UP" || type == "LO" || type == "FX" ||
+                       type == "LI" || type == "UI";
+    // Bound set names are optional
+    idx_t column_token = needs_value ? (count >= 4 ? 2 : 1)
+                                     : (count >= 3 ? 2 : 1);
+    if (column_token >= count || (needs_value && column_token + 1 >= count)) {
+      Error("incomplete " + type + " bound");
+    }
+    int col = FindColumn(tokens[column_token]);
+    double value = needs_value ? ParseNumber(tokens[column_token + 1]) : 0.0;
+    double &lower = model_info.var_lower_bounds[col];
+    double &upper = model_info.var_upper_bounds[col];
+    auto &var_type = model_info.variable_types[col];
+    if (var_type == HighsVariableType::BINARY && type != "BV") {
+      var_type = HighsVariableType::INTEGER;
+    }
+
+    if (type == "UP" || type == "UI") {
+      upper = value;
+      if (value < 0 && lower == 0) {
+        lower = -kHighsInf;
+      }
+    } else if (type == "LO" || type == "LI") {
+      lower = value;
+    } else if (type == "FX") {
+      lower = upper = value;
+    } else if (type == "FR") {
+      lower = -kHighsInf;
+      upper = kHighsInf;
+    } else if (type == "MI") {
+      lower = -kHighsInf;
+    } else if (type == "PL") {
+      upper = kHighsInf;
+    } else if (type == "BV") {
+      lower = 0;
+      upper = 1;
+      var_type = HighsVariableType::BINARY;
+    } else {
+      Error("unsupported bound type '" + type + "'");
+    }
+    if (type == "LI" || type == "UI") {
+      var_type = HighsVariableType::INTEGER;
+    }
+  }
+
+  void Parse() {
+    char *tokens[8];
+    while (char *line = reader.Next()) {
+      if (line[0] == '*' || line[0] == '\0') {
+        continue;
+      }
+      bool header = line[0] != ' ' && line[0] != '\t';
+      idx_t count = Tokenize(line, tokens, 8);
+      if (count == 0) {
+        continue;
+      }
+      if (header) {
+        StartSection(tokens, count);
+        if (section > MpsSection::ROWS) {
+          PrepareRows();
+        }
+        if (section == MpsSection::END) {
+          break;
+        }
+        continue;
+      }
+      switch (section) {
+      case MpsSection::OBJSENSE:
+        ParseSense(tokens[0]);
+        break;
+      case MpsSection::ROWS:
+        ParseRow(tokens, count);
+        break;
+      case MpsSection::COLUMNS:
+        ParseColumn(tokens, count);
+        break;
+      case MpsSection::RHS:
+        ParseRowValues(tokens, count, false);
+        break;
+      case MpsSection::RANGES:
+        ParseRowValues(tokens, count, true);
+        break;
+      case MpsSection::BOUNDS:
+        ParseBound(tokens, count);
+        break;
+      default:
+        Error("data outside of a section");
+      }
+    }
+    if (section != MpsSection::END) {
+      Error("missing ENDATA");
+    }
+    PrepareRows();
+    FinishRows();
+  }
+
+  void PrepareRows() {
+    idx_t num_rows = row_types.size();
+    rhs.resize(num_rows, 0.0);
+    ranges.resize(num_rows, 0.0);
+    has_range.resize(num_rows, false);
+  }
+
+  // Turn row types, right-hand sides and ranges into row bounds
+  void FinishRows() {
+    idx_t num_rows = row_types.size();
+    model_info.constraint_lower_bounds.resize(num_rows);
+    model_info.constraint_upper_bounds.resize(num_rows);
+    for (idx_t row = 0; row < num_rows; row++) {
+      double lower = rhs[row];
+      double upper = rhs[row];
+      double range = std::abs(ranges[row]);
+      switch (row_types[row]) {
+      case 'L':
+        lower = has_range[row] ? upper - range : -kHighsInf;
+        break;
+      case 'G':
+        upper = has_range[row] ? lower + range : kHighsInf;
+        break;
+      case 'N':
+        lower = -kHighsInf;
+        upper = kHighsInf;
+        break;
+      default: // 'E'
+        if (has_range[row]) {
+          if (ranges[row] > 0) {
+            upper = lower + range;
+          } else {
+            lower = upper - range;
+          }
+        }
+        break;
+      }
+      model_info.constraint_lower_bounds[row] = lower;
+      model_info.constraint_upper_bounds[row] = upper;
+    }
+    model_info.next_var_index = (int)model_info.variable_names.Size();
+    model_info.next_constraint_index = (int)num_rows;
+  }
+};
+
+// Buffered writes to a file handle
+class MpsWriter {
+public:
+  MpsWriter(FileHandle &handle) : handle(handle) { buffer.reserve(kFlushSize); }
+
+  void Write(const char *data, idx_t size) {
+    buffer.append(data, size);
+    if (buffer.size() >= kFlushSize) {
+      Flush();
+    }
+  }
+  void Write(const std::string &text) { Write(text.data(), text.size()); }
+
+  // "    <a> <b> <value>\n"
+  void Entry(const std::string &first, const std::string &second,
+             double value) {
+    char number[32];
+    int length = std::snprintf(number, sizeof(number), "%.17g", value);
+    buffer += "    ";
+    buffer += first;
+    buffer += ' ';
+    buffer += second;
+    buffer += ' ';
+    Write(number, (idx_t)length);
+    Write("\n", 1);
+  }
+
+  void Flush() {
+    handle.Write((void *)buffer.data(), buffer.size());
+    buffer.clear();
+  }
+
+private:
+  static constexpr idx_t kFlushSize = 1 << 20;
+
+  FileHandle &handle;
+  std::string buffer;
+};
+
+// Name of a column or row in the file. MPS fields are separated by
+// whitespace, so names containing any cannot be written.
+std::string MpsName(const HighsNameTable &names, const HighsIdMap &ids,
+                    char prefix, idx_t index) {
+  if (index < names.Size()) {
+    std::string name = names.GetString(index);
+    if (name.empty() || name.find_first_of(" \t\r\n") != std::string::npos) {
+      throw std::runtime_error(
+          std::string(prefix == 'C' ? "Variable" : "Constraint") + " name '" +
+          name + "' cannot be written to MPS: names must be non-empty and "
+          "must not contain whitespace");
+    }
+    return name;
+  }
+  if (index < ids.Size()) {
+    return prefix + std::to_string(ids.Get(index));
+  }
+  return prefix + std::to_string(index);
+}
+
+// Loaders are commonly given 1e30 for an infinite bound; writing it as a
+// finite value would add RHS, RANGES and BOUNDS entries for free bounds
+constexpr double kMpsInfinity = 1e30;
+
+double FiniteOrInfinite(double value) {
+  return value >= kMpsInfinity    ? kHighsInf
+         : value <= -kMpsInfinity ? -kHighsInf
+                                  : value;
+}
+
+} // namespace
+
+HighsModelFileStats ReadMpsModel(ClientContext &context,
+                                 const std::string &path,
+                                 HighsModelInfo &model_info) {
+  auto &fs = FileSystem::GetFileSystem(context);
+  auto handle = fs.OpenFile(path, FileFlags::FILE_FLAGS_READ |
+                                      FileCompressionType::AUTO_DETECT);
+  MpsLineReader reader(*handle);
+  MpsParser parser(context, reader, model_info);
+  try {
+    parser.Parse();
+  } catch (...) {
+    model_info.Clear();
+    throw;
+  }
+
+  HighsModelFileStats stats;
+  stats.num_columns = model_info.next_var_index;
+  stats.num_rows = model_info.next_constraint_index;
+  stats.num_nonzeros = parser.num_nonzeros;
+  return stats;
+}
+
+HighsModelFileStats WriteMpsModel(ClientContext &context,
+                                  const std::string &path,
+                                  const std::string &model_name,
+                                  const HighsModelInfo &model_info) {
+  idx_t num_col = model_info.next_var_index;
+  idx_t num_row = model_info.next_constraint_index;
+  // Names and bounds up front, so a name that cannot be written fails
+  // before the file is created
+  std::vector<std::string> rows(num_row);
+  std::vector<double> row_lower(num_row);
+  std::vector<double> row_upper(num_row);
+  for (idx_t row = 0; row < num_row; row++) {
+    rows[row] = MpsName(model_info.constraint_names, model_info.constraint_ids,
+                        'R', row);
+    row_lower[row] = FiniteOrInfinite(model_info.constraint_lower_bounds[row]);
+    row_upper[row] = FiniteOrInfinite(model_info.constraint_upper_bounds[row]);
+  }
+  std::vector<std::string> columns(num_col);
+  for (idx_t col = 0; col < num_col; col++) {
+    columns[col] =
+        MpsName(model_info.variable_names, model_info.variable_ids, 'C', col);
+  }
+  // The reader takes the first N row for the objective, so its name must
+  // not be one a constraint already uses
+  std::string objective = "OBJ";
+  {
+    std::unordered_set<std::string> taken(rows.begin(), rows.end());
+    for (idx_t suffix = 1; taken.count(objective); suffix++) {
+      objective = "OBJ_" + std::to_string(suffix);
+    }
+  }
+
+  HighsColwiseMatrix matrix;
+  AssembleColwiseMatrix(
+      (HighsInt)num_col, model_info.constraint_coefficients, matrix,
+      HighsSolveWidth(HighsThreadSettings::FromContext(context),
+                      model_info.options));
+
+  auto &fs = FileSystem::GetFileSystem(context);
+  auto compression = StringUtil::EndsWith(StringUtil::Lower(path), ".gz")
+                         ? FileCompressionType::GZIP
+                         : FileCompressionType::UNCOMPRESSED;
+  auto handle = fs.OpenFile(path, FileFlags::FILE_FLAGS_WRITE |
+                                      FileFlags::FILE_FLAGS_FILE_CREATE_NEW |
+                                      compression);
+  MpsWriter out(*handle);
+
+  out.Write("NAME " + model_name + "\n");
+  if (model_info.model.lp_.sense_ == ObjSense::kMaximize) {
+    out.Write("OBJSENSE\n    MAX\n");
+  }
+  // Free rows are written as N rows, which the reader keeps as constraints
+  out.Write("ROWS\n N  " + objective + "\n");
+  for (idx_t row = 0; row < num_row; row++) {
+    double lower = row_lower[row];
+    double upper = row_upper[row];
+    const char *type = lower == upper                ? " E  "
+                       : upper < kHighsInf          ? " L  "
+                       : lower > -kHighsInf         ? " G  "
+                                                    : " N  ";
+    out.Write(type + rows[row] + "\n");
+  }
+
+  out.Write("COLUMNS\n");
+  bool in_integer_block = false;
+  for (idx_t col = 0; col < num_col; col++) {
+    bool integer =
+        model_info.variable_types[col] != HighsVariableType::CONTINUOUS;
+    if (integer != in_integer_block) {
+      out.Write(integer ? "    MARKER 'MARKER' 'INTORG'\n"
+                        : "    MARKER 'MARKER' 'INTEND'\n");
+      in_integer_block = integer;
+    }
+    const std::string &name = columns[col];
+    double cost = model_info.obj_coefficients[col];
+    bool empty = matrix.start[col] == matrix.start[col + 1];
+    if (cost != 0 || empty) {
+      // Every column needs at least one entry to be declared
+      out.Entry(name, objective, cost);
+    }
+    for (HighsInt k = matrix.start[col]; k < matrix.start[col + 1]; k++) {
+      out.Entry(name, rows[matrix.index[k]], matrix.value[k]);
+    }
+  }
+  if (in_integer_block) {
+    out.Write("    MARKER 'MARKER' 'INTEND'\n");
+  }
+
+  out.Write("RHS\n");
+  if (model_info.model.lp_.offset_ != 0) {
+    out.Entry("RHS", objective, -model_info.model.lp_.offset_);
+  }
+  for (idx_t row = 0; row < num_row; row++) {
+    double lower = row_lower[row];
+    double upper = row_upper[row];
+    double rhs = upper < kHighsInf ? upper : lower;
+    if (rhs != 0 && std::abs(rhs) < kHighsInf) {
+      out.Entry("RHS", rows[row], rhs);
+    }
+  }
+  bool has_ranges = false;
+  for (idx_t row = 0; row < num_row; row++) {
+    double lower = row_lower[row];
+    double upper = row_upper[row];
+    if (lower != upper && lower > -kHighsInf && upper < kHighsInf) {
+      if (!has_ranges) {
+        out.Write("RANGES\n");
+        has_ranges = true;
+      }
+      out.Entry("RNG", rows[row], upper - lower);
+    }
+  }
+
+  out.Write("BOUNDS\n");
+  for (idx_t col = 0; col < num_col; col++) {
+    const std::string &name = columns[col];
+    double lower = FiniteOrInfinite(model_info.var_lower_bounds[col]);
+    double upper = FiniteOrInfinite(model_info.var_upper_bounds[col]);
+    HighsVariableType var_type = model_info.variable_types[col];
+    if (var_type == HighsVariableType::BINARY) {
+      lower = MaxValue(0.0, lower);
+      upper = MinValue(1.0, upper);
+      if (lower == 0 && upper == 1) {
+        out.Write(" BV BND " + name + "\n");
+        continue;
+      }
+    } else if (var_type == HighsVariableType::INTEGER && lower == 0 &&
+               upper >= kHighsInf) {
+      // Without a bound the reader would take the column for binary
+      out.Write(" PL BND " + name + "\n");
+      continue;
+    }
+    if (lower == upper) {
+      out.Entry("FX BND", name, lower);
+    } else if (lower <= -kHighsInf && upper >= kHighsInf) {
+      out.Write(" FR BND " + name + "\n");
+    } else {
+      if (lower <= -kHighsInf) {
+        out.Write(" MI BND " + name + "\n");
+      } else if (lower != 0) {
+        out.Entry("LO BND", name, lower);
+      }
+      if (upper < kHighsInf) {
+        out.Entry("UP BND", name, upper);
+      }
+    }
+  }
+  out.Write("ENDATA\n");
+  out.Flush();
+  handle->Close();
+
+  HighsModelFileStats stats;
+  stats.num_columns = num_col;
+  stats.num_rows = num_row;
+  stats.num_nonzeros = matrix.value.size();
+  return stats;
+}
+
+} // namespace duckdb
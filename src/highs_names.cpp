@@ -0,0 +1,194 @@
+#include "highs_names.hpp"
+#include "duckdb/common/types/hash.hpp"
+
+#include <cstring>
+
+namespace duckdb {
+
+constexpr idx_t HighsNameArena::kBlockSize;
+constexpr uint64_t HighsNameTable::kEmptySlot;
+constexpr uint32_t HighsIdMap::kEmptySlot;
+
+const char *HighsNameArena::Add(const char *data, idx_t size) {
+  char *result;
+  if (size > kBlockSize / 4) {
+    // Oversized names get a block of their own, leaving the current block
+    // open for the names after them
+    blocks.emplace_back(new char[size]);
+    allocated_bytes += size;
+    result = blocks.back().get();
+  } else {
+    if (block_used + size > kBlockSize) {
+      blocks.emplace_back(new char[kBlockSize]);
+      allocated_bytes += kBlockSize;
+      current_block = blocks.back().get();
+      block_used = 0;
+    }
+    result = current_block + block_used;
+    block_used += size;
+  }
+  std::memcpy(result, data, size);
+  return result;
+}
+
+HighsNameTable::HighsNameTable() : arena(make_buffer<HighsNameArena>()) {
+  slots.resize(16, kEmptySlot);
+}
+
+int HighsNameTable::Find(const char *data, idx_t size) const {
+  hash_t hash = Hash(data, size);
+  idx_t mask = slots.size() - 1;
+  for (idx_t pos = hash & mask;; pos = (pos + 1) & mask) {
+    uint64_t slot = slots[pos];
+    if (slot == kEmptySlot) {
+      return -1;
+    }
+    if ((slot >> 32) != (hash >> 32)) {
+      continue;
+    }
+    idx_t index = (slot & 0xFFFFFFFFULL) - 1;
+    const string_t &name = names[index];
+    if (name.GetSize() == size &&
+        std::memcmp(name.GetData(), data, size) == 0) {
+      return (int)index;
+    }
+  }
+}
+
+int HighsNameTable::Insert(const char *data, idx_t size) {
+  if ((names.size() + 1) * 4 > slots.size() * 3) {
+    Rehash(slots.size() * 2);
+  }
+
+  hash_t hash = Hash(data, size);
+  idx_t mask = slots.size() - 1;
+  idx_t pos = hash & mask;
+  for (;; pos = (pos + 1) & mask) {
+    uint64_t slot = slots[pos];
+    if (slot == kEmptySlot) {
+      break;
+    }
+    if ((slot >> 32) != (hash >> 32)) {
+      continue;
+    }
+    const string_t &name = names[(slot & 0xFFFFFFFFULL) - 1];
+    if (name.GetSize() == size &&
+        std::memcmp(name.GetData(), data, size) == 0) {
+      return -1;
+    }
+  }
+
+  idx_t index = names.size();
+  if (size <= string_t::INLINE_LENGTH) {
+    names.emplace_back(data, (uint32_t)size);
+  } else {
+    names.emplace_back(arena->Add(data, size), (uint32_t)size);
+  }
+  slots[pos] = MakeSlot(hash, index);
+  return (int)index;
+}
+
+void HighsNameTable::Reserve(idx_t count) {
+  ReserveGrown(names, count);
+  idx_t capacity = SlotCapacity(slots.size(), count);
+  if (capacity != slots.size()) {
+    Rehash(capacity);
+  }
+}
+
+void HighsNameTable::Rehash(idx_t capacity) {
+  std::vector<uint64_t> new_slots(capacity, kEmptySlot);
+  idx_t mask = capacity - 1;
+  for (idx_t index = 0; index < names.size(); index++) {
+    const string_t &name = names[index];
+    hash_t hash = Hash(name.GetData(), name.GetSize());
+    idx_t pos = hash & mask;
+    while (new_slots[pos] != kEmptySlot) {
+      pos = (pos + 1) & mask;
+    }
+    new_slots[pos] = MakeSlot(hash, index);
+  }
+  slots = std::move(new_slots);
+}
+
+HighsIdMap::HighsIdMap() { slots.resize(16, kEmptySlot); }
+
+int HighsIdMap::Find(int64_t id) const {
+  idx_t mask = slots.size() - 1;
+  for (idx_t pos = Hash<int64_t>(id) & mask;; pos = (pos + 1) & mask) {
+    uint32_t slot = slots[pos];
+    if (slot == kEmptySlot) {
+      return -1;
+    }
+    if (ids[slot - 1] == id) {
+      return (int)(slot - 1);
+    }
+  }
+}
+
+int HighsIdMap::Insert(int64_t id) {
+  if ((ids.size() + 1) * 4 > slots.size() * 3) {
+    Rehash(slots.size() * 2);
+  }
+
+  idx_t mask = slots.size() - 1;
+  idx_t pos = Hash<int64_t>(id) & mask;
+  for (; slots[pos] != kEmptySlot; pos = (pos + 1) & mask) {
+    if (ids[slots[pos] - 1] == id) {
+      return -1;
+    }
+  }
+
+  int index = (int)ids.size();
+  ids.push_back(id);
+  slots[pos] = (uint32_t)(index + 1);
+  return index;
+}
+
+void HighsIdMap::Reserve(idx_t count) {
+  ReserveGrown(ids, count);
+  idx_t capacity = SlotCapacity(slots.size(), count);
+  if (capacity != slots.size()) {
+    Rehash(capacity);
+  }
+}
+
+void HighsIdMap::Rehash(idx_t capacity) {
+  std::vector<uint32_t> new_slots(capacity, kEmptySlot);
+  idx_t mask = capacity - 1;
+  for (idx_t index = 0; index < ids.size(); index++) {
+    idx_t pos = Hash<int64_t>(ids[index]) & mask;
+    while (new_slots[pos] != kEmptySlot) {
+      pos = (pos + 1) & mask;
+    }
+    new_slots[pos] = (uint32_t)(index + 1);
+  }
+  slots = std::move(new_slots);
+}
+
+void AttachNameArena(Vector &vector, const buffer_ptr<HighsNameArena> &arena) {
+  StringVector::AddBuffer(vector, arena);
+}
+
+string_t FormatIndexedName(Vector &vector, const string_t &name, idx_t index) {
+  char digits[20];
+  idx_t num_digits = 0;
+  do {
+    digits[num_digits++] = (char)('0' + index % 10);
+    index /= 10;
+  } while (index > 0);
+
+  idx_t name_size = name.GetSize();
+  auto result =
+      StringVector::EmptyString(vector, name_size + 1 + num_digits);
+  char *data = result.GetDataWriteable();
+  std::memcpy(data, name.GetData(), name_size);
+  data[name_size] = '_';
+  for (idx_t i = 0; i < num_digits; i++) {
+    data[name_size + 1 + i] = digits[num_digits - 1 - i];
+  }
+  result.Finalize();
+  return result;
+}
+
+} // namespace duckdb
@@ -0,0 +1,130 @@
+#include "highs_output.hpp"
+#include "duckdb/planner/expression/bound_conjunction_expression.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/planner/table_filter.hpp"
+
+namespace duckdb {
+
+const std::vector<HighsSolveColumn> &SolveSchema(HighsSolveOutput output) {
+  static const std::vector<HighsSolveColumn> name_schema = {
+      HighsSolveColumn::VARIABLE_NAME,  HighsSolveColumn::VARIABLE_INDEX,
+      HighsSolveColumn::SOLUTION_VALUE, HighsSolveColumn::REDUCED_COST,
+      HighsSolveColumn::STATUS,         HighsSolveColumn::COLUMN_INDEX};
+  static const std::vector<HighsSolveColumn> id_schema = {
+      HighsSolveColumn::VARIABLE_ID, HighsSolveColumn::SOLUTION_VALUE,
+      HighsSolveColumn::REDUCED_COST, HighsSolveColumn::STATUS,
+      HighsSolveColumn::COLUMN_INDEX};
+  static const std::vector<HighsSolveColumn> constraint_schema = {
+      HighsSolveColumn::CONSTRAINT_NAME, HighsSolveColumn::CONSTRAINT_ID,
+      HighsSolveColumn::ROW_ACTIVITY,    HighsSolveColumn::DUAL_VALUE,
+      HighsSolveColumn::SLACK,           HighsSolveColumn::STATUS,
+      HighsSolveColumn::ROW_INDEX};
+  switch (output) {
+  case HighsSolveOutput::VARIABLE_IDS:
+    return id_schema;
+  case HighsSolveOutput::CONSTRAINTS:
+    return constraint_schema;
+  default:
+    return name_schema;
+  }
+}
+
+static const char *SolveColumnName(HighsSolveColumn column) {
+  switch (column) {
+  case HighsSolveColumn::VARIABLE_NAME:
+    return "variable_name";
+  case HighsSolveColumn::VARIABLE_INDEX:
+    return "variable_index";
+  case HighsSolveColumn::VARIABLE_ID:
+    return "variable_id";
+  case HighsSolveColumn::SOLUTION_VALUE:
+    return "solution_value";
+  case HighsSolveColumn::REDUCED_COST:
+    return "reduced_cost";
+  case HighsSolveColumn::COLUMN_INDEX:
+    return "column_index";
+  case HighsSolveColumn::CONSTRAINT_NAME:
+    return "constraint_name";
+  case HighsSolveColumn::CONSTRAINT_ID:
+    return "constraint_id";
+  case HighsSolveColumn::ROW_ACTIVITY:
+    return "row_activity";
+  case HighsSolveColumn::DUAL_VALUE:
+    return "dual_value";
+  case HighsSolveColumn::SLACK:
+    return "slack";
+  case HighsSolveColumn::ROW_INDEX:
+    return "row_index";
+  default:
+    return "status";
+  }
+}
+
+LogicalType SolveColumnType(HighsSolveColumn column) {
+  switch (column) {
+  case HighsSolveColumn::VARIABLE_NAME:
+  case HighsSolveColumn::VARIABLE_INDEX:
+  case HighsSolveColumn::CONSTRAINT_NAME:
+  case HighsSolveColumn::STATUS:
+    return LogicalType::VARCHAR;
+  case HighsSolveColumn::SOLUTION_VALUE:
+  case HighsSolveColumn::REDUCED_COST:
+  case HighsSolveColumn::ROW_ACTIVITY:
+  case HighsSolveColumn::DUAL_VALUE:
+  case HighsSolveColumn::SLACK:
+    return LogicalType::DOUBLE;
+  default:
+    return LogicalType::BIGINT;
+  }
+}
+
+void SetSolveSchema(const std::vector<HighsSolveColumn> &schema,
+                    vector<LogicalType> &return_types, vector<string> &names) {
+  for (auto column : schema) {
+    names.emplace_back(SolveColumnName(column));
+    return_types.push_back(SolveColumnType(column));
+  }
+}
+
+void HighsSolveProjection::Initialize(
+    ClientContext &context, const TableFunctionInitInput &input,
+    const std::vector<HighsSolveColumn> &schema) {
+  columns.clear();
+  for (auto column_id : input.column_ids) {
+    // The row id, the only virtual column, is the HiGHS index
+    columns.push_back(column_id < schema.size() ? schema[column_id]
+                                                : schema.back());
+  }
+
+  if (!input.filters || input.filters->filters.empty()) {
+    return;
+  }
+  // Filters are keyed by position in the projection, which is also the
+  // position of the column in the emitted chunk
+  auto conjunction =
+      make_uniq<BoundConjunctionExpression>(ExpressionType::CONJUNCTION_AND);
+  for (auto &entry : input.filters->filters) {
+    BoundReferenceExpression column(SolveColumnType(columns[entry.first]),
+                                    entry.first);
+    conjunction->children.push_back(entry.second->ToExpression(column));
+  }
+  if (conjunction->children.size() == 1) {
+    filter_expression = std::move(conjunction->children[0]);
+  } else {
+    filter_expression = std::move(conjunction);
+  }
+  filter = make_uniq<ExpressionExecutor>(context, *filter_expression);
+  selection.Initialize(STANDARD_VECTOR_SIZE);
+}
+
+void HighsSolveProjection::Filter(DataChunk &chunk) {
+  if (!filter || chunk.size() == 0) {
+    return;
+  }
+  idx_t count = filter->SelectExpression(chunk, selection);
+  if (count < chunk.size()) {
+    chunk.Slice(selection, count);
+  }
+}
+
+} // namespace duckdb
@@ -0,0 +1,131 @@
+#include "highs_profile.hpp"
+#include "highs_model.hpp"
+#include "highs_monitor.hpp"
+
+#include <cmath>
+
+namespace duckdb {
+
+constexpr idx_t HighsSolveLog::kMaxEntries;
+
+void RecordRunProfile(const Highs &highs, const HighsRunMonitor &monitor,
+                      double run_time, HighsSolveProfile &profile) {
+  // No solver callback means presolve (or there being nothing to iterate)
+  // accounts for the whole run
+  double solver_started = monitor.SolverStarted();
+  profile.presolve_time = std::isnan(solver_started)
+                              ? run_time
+                              : MinValue(solver_started, run_time);
+  profile.solve_time = run_time - profile.presolve_time;
+
+  // HiGHS reports -1 for counts it has no value for
+  const HighsInfo &info = highs.getInfo();
+  profile.simplex_iterations =
+      MaxValue<int64_t>(0, info.simplex_iteration_count);
+  profile.ipm_iterations = MaxValue<int64_t>(0, info.ipm_iteration_count);
+  profile.crossover_iterations =
+      MaxValue<int64_t>(0, info.crossover_iteration_count);
+  profile.mip_nodes = MaxValue<int64_t>(0, info.mip_node_count);
+  profile.mip = highs.getLp().isMip();
+  profile.mip_gap = info.mip_gap;
+  profile.presolve_removed_rows = 0;
+  profile.presolve_removed_columns = 0;
+  for (auto &rule : highs.getPresolveLog().rule) {
+    profile.presolve_removed_rows += rule.row_removed;
+    profile.presolve_removed_columns += rule.col_removed;
+  }
+}
+
+uint64_t HighsSolveLog::Record(HighsSolveProfile profile) {
+  std::lock_guard<std::mutex> guard(mutex);
+  profile.solve_id = next_solve_id++;
+  entries.push_back(std::move(profile));
+  if (entries.size() > kMaxEntries) {
+    entries.pop_front();
+  }
+  return entries.back().solve_id;
+}
+
+void HighsSolveLog::AddEmission(uint64_t solve_id, double seconds) {
+  std::lock_guard<std::mutex> guard(mutex);
+  // Ids are consecutive, so the entry's position follows from the first id
+  if (entries.empty() || solve_id < entries.front().solve_id) {
+    return;
+  }
+  idx_t position = solve_id - entries.front().solve_id;
+  if (position < entries.size()) {
+    entries[position].emission_time += seconds;
+  }
+}
+
+std::vector<HighsSolveProfile> HighsSolveLog::Entries() {
+  std::lock_guard<std::mutex> guard(mutex);
+  return std::vector<HighsSolveProfile>(entries.begin(), entries.end());
+}
+
+template <class T> static idx_t VectorBytes(const std::vector<T> &values) {
+  return values.capacity() * sizeof(T);
+}
+
+static idx_t KeyBytes(const HighsNameTable &names, const HighsIdMap &ids) {
+  return names.AllocatedBytes() + ids.AllocatedBytes();
+}
+
+static idx_t LpBytes(const HighsLp &lp) {
+  return VectorBytes(lp.col_cost_) + VectorBytes(lp.col_lower_) +
+         VectorBytes(lp.col_upper_) + VectorBytes(lp.row_lower_) +
+         VectorBytes(lp.row_upper_) + VectorBytes(lp.a_matrix_.start_) +
+         VectorBytes(lp.a_matrix_.index_) +
+         VectorBytes(lp.a_matrix_.value_) + VectorBytes(lp.integrality_);
+}
+
+// The result's values and key lists; names live in the model's arena
+static idx_t ResultBytes(const HighsSolveResult &result) {
+  return VectorBytes(result.col_value) + VectorBytes(result.col_dual) +
+         VectorBytes(result.row_value) + VectorBytes(result.row_dual) +
+         VectorBytes(result.row_slack) + VectorBytes(result.columns.names) +
+         VectorBytes(result.columns.ids) + VectorBytes(result.rows.names) +
+         VectorBytes(result.rows.ids);
+}
+
+HighsModelStats ComputeModelStats(HighsModelInfo &model_info) {
+  HighsModelStats stats;
+  std::unique_lock<std::timed_mutex> solver_guard(model_info.solver_mutex,
+                                                  std::try_to_lock);
+  HighsSharedLock guard(model_info.mutex);
+
+  stats.num_variables = model_info.next_var_index;
+  stats.num_constraints = model_info.next_constraint_index;
+  stats.num_nonzeros = model_info.constraint_coefficients.Size();
+  stats.coefficient_bytes =
+      model_info.constraint_coefficients.AllocatedBytes();
+  stats.type_bytes = VectorBytes(model_info.variable_types);
+  for (auto var_type : model_info.variable_types) {
+    if (var_type != HighsVariableType::CONTINUOUS) {
+      stats.num_integer++;
+    }
+  }
+
+  stats.variable_key_bytes =
+      KeyBytes(model_info.variable_names, model_info.variable_ids);
+  stats.constraint_key_bytes =
+      KeyBytes(model_info.constraint_names, model_info.constraint_ids);
+  stats.objective_bytes = VectorBytes(model_info.obj_coefficients);
+  stats.bound_bytes = VectorBytes(model_info.var_lower_bounds) +
+                      VectorBytes(model_info.var_upper_bounds) +
+                      VectorBytes(model_info.constraint_lower_bounds) +
+                      VectorBytes(model_info.constraint_upper_bounds);
+
+  if (solver_guard.owns_lock()) {
+    stats.solver_known = true;
+    if (model_info.solver) {
+      stats.solver_bytes = LpBytes(model_info.solver->getLp());
+    }
+    if (model_info.last_result) {
+      stats.result_bytes = ResultBytes(*model_info.last_result);
+    }
+  }
+  return stats;
+}
+
+} // namespace duckdb
@@ -0,0 +1,448 @@
+#include "highs_snapshot.hpp"
+#include "duckdb/common/file_system.hpp"
+
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+namespace duckdb {
+
+namespace {
+
+constexpr char kSnapshotMagic[8] = {'H', 'I', 'G', 'H', 'S', 'M', 'D', 'L'};
+constexpr uint32_t kSnapshotVersion = 1;
+// Written as a uint32 so snapshots from a host of the other byte order are
+// rejected instead of misread
+constexpr uint32_t kByteOrderMark = 0x01020304;
+
+enum class SnapshotVarType : uint8_t {
+  CONTINUOUS = 0,
+  INTEGER = 1,
+  BINARY = 2
+};
+
+struct SnapshotHeader {
+  char magic[8];
+  uint32_t version;
+  uint32_t byte_order;
+  uint8_t key_type;
+  uint8_t maximize;
+  uint8_t has_basis;
+  uint8_t reserved[5];
+  double offset;
+  uint64_t num_columns;
+  uint64_t num_rows;
+  uint64_t num_nonzeros;
+  uint64_t num_options;
+};
+
+class SnapshotWriter {
+public:
+  SnapshotWriter(FileHandle &handle) : handle(handle) {}
+
+  void Write(const void *data, idx_t size) {
+    if (size > 0) {
+      handle.Write(const_cast<void *>(data), size);
+    }
+  }
+  template <class T> void WriteArray(const std::vector<T> &values) {
+    Write(values.data(), values.size() * sizeof(T));
+  }
+  void WriteString(const std::string &value) {
+    uint32_t size = (uint32_t)value.size();
+    Write(&size, sizeof(size));
+    Write(value.data(), size);
+  }
+
+private:
+  FileHandle &handle;
+};
+
+// Reads are checked against the bytes left in the file before anything is
+// allocated, so a corrupt count fails fast instead of asking for memory
+class SnapshotReader {
+public:
+  SnapshotReader(FileHandle &handle)
+      : handle(handle), remaining(handle.GetFileSize()) {}
+
+  idx_t Remaining() const { return remaining; }
+
+  void Read(void *data, idx_t size) {
+    Require(size, 1);
+    remaining -= size;
+    auto out = (char *)data;
+    while (size > 0) {
+      auto read = handle.Read(out, size);
+      if (read <= 0) {
+        throw std::runtime_error("Snapshot is truncated");
+      }
+      out += read;
+      size -= (idx_t)read;
+    }
+  }
+  template <class T> void ReadArray(std::vector<T> &values, idx_t count) {
+    Require(count, sizeof(T));
+    values.resize(count);
+    Read(values.data(), count * sizeof(T));
+  }
+  std::string ReadString() {
+    uint32_t size;
+    Read(&size, sizeof(size));
+    Require(size, 1);
+    std::string value(size, '\0');
+    Read(&value[0], size);
+    return value;
+  }
+
+  // Throw unless count items of item_size bytes are left in the file
+  void Require(idx_t count, idx_t item_size) const {
+    if (count > remaining / item_size) {
+      throw std::runtime_error("Snapshot is truncated");
+    }
+  }
+
+private:
+  FileHandle &handle;
+  idx_t remaining;
+};
+
+void WriteNames(SnapshotWriter &out, const HighsNameTable &table) {
+  std::vector<uint32_t> sizes;
+  sizes.reserve(table.Size());
+  for (auto &name : table.Names()) {
+    sizes.push_back((uint32_t)name.GetSize());
+  }
+  out.WriteArray(sizes);
+  for (auto &name : table.Names()) {
+    out.Write(name.GetData(), name.GetSize());
+  }
+}
+
+void ReadNames(SnapshotReader &in, idx_t count, HighsNameTable &table,
+               const char *kind) {
+  std::vector<uint32_t> sizes;
+  in.ReadArray(sizes, count);
+  idx_t total = 0;
+  for (auto size : sizes) {
+    total += size;
+  }
+  std::vector<char> bytes;
+  in.ReadArray(bytes, total);
+  table.Reserve(count);
+  const char *data = bytes.data();
+  for (auto size : sizes) {
+    if (table.Insert(data, size) < 0) {
+      throw std::runtime_error(std::string("Snapshot has a duplicate ") +
+                               kind + " name '" + std::string(data, size) +
+                               "'");
+    }
+    data += size;
+  }
+}
+
+void ReadIds(SnapshotReader &in, idx_t count, HighsIdMap &map,
+             const char *kind) {
+  std::vector<int64_t> ids;
+  in.ReadArray(ids, count);
+  map.Reserve(count);
+  for (auto id : ids) {
+    if (map.Insert(id) < 0) {
+      throw std::runtime_error(std::string("Snapshot has a duplicate ") +
+                               kind + " id " + std::to_string(id));
+    }
+  }
+}
+
+HighsBasisStatus ToBasisStatus(uint8_t status) {
+  if (status > (uint8_t)HighsBasisStatus::kNonbasic) {
+    throw std::runtime_error("Snapshot has an invalid basis status");
+  }
+  return (HighsBasisStatus)status;
+}
+
+void LoadSnapshot(SnapshotReader &in, HighsModelInfo &model_info,
+                  HighsModelFileStats &stats) {
+  SnapshotHeader header;
+  in.Read(&header, sizeof(header));
+  if (std::memcmp(header.magic, kSnapshotMagic, sizeof(kSnapshotMagic)) != 0) {
+    throw std::runtime_error("Not a HiGHS model snapshot");
+  }
+  if (header.byte_order != kByteOrderMark) {
+    throw std::runtime_error("Snapshot was written with another byte order");
+  }
+  if (header.version != kSnapshotVersion) {
+    throw std::runtime_error("Unsupported snapshot version " +
+                             std::to_string(header.version));
+  }
+  if (header.num_columns > (uint64_t)std::numeric_limits<int>::max() ||
+      header.num_rows > (uint64_t)std::numeric_limits<int>::max()) {
+    throw std::runtime_error("Snapshot model is too large");
+  }
+  idx_t num_col = header.num_columns;
+  idx_t num_row = header.num_rows;
+  idx_t nnz = header.num_nonzeros;
+  // Check the counts against the file size before allocating for them.
+  // Column and row counts are below 2^31, so these sums cannot overflow.
+  idx_t fixed_bytes = num_col * (3 * sizeof(double) + sizeof(uint8_t)) +
+                      num_row * 2 * sizeof(double) +
+                      (num_row + 1) * sizeof(uint64_t);
+  in.Require(fixed_bytes, 1);
+  if (nnz > (in.Remaining() - fixed_bytes) /
+                (sizeof(int32_t) + sizeof(double)) ||
+      header.num_options > in.Remaining() / (2 * sizeof(uint32_t))) {
+    throw std::runtime_error("Snapshot is truncated");
+  }
+
+  if (header.key_type > (uint8_t)HighsKeyType::ID) {
+    throw std::runtime_error("Snapshot has an unknown key type");
+  }
+  model_info.key_type = (HighsKeyType)header.key_type;
+  model_info.model.lp_.sense_ =
+      header.maximize ? ObjSense::kMaximize : ObjSense::kMinimize;
+  model_info.model.lp_.offset_ = header.offset;
+
+  // Charge the arrays the header promises, and the staging arrays the types
+  // and matrix are read through, before any of them is allocated. A restore
+  // has charged the spilled size already. Name bytes are charged with the
+  // rest once the load is done.
+  idx_t staging_bytes = num_col * sizeof(uint8_t) +
+                        (num_row + 1) * sizeof(uint64_t) +
+                        nnz * (sizeof(int32_t) + sizeof(double));
+  idx_t load_bytes = model_info.ReserveVariablesBytes(num_col) +
+                     model_info.ReserveConstraintsBytes(num_row) +
+                     model_info.constraint_coefficients.ReserveBytes(nnz) +
+                     staging_bytes;
+  if (load_bytes > model_info.model_memory.Bytes()) {
+    model_info.model_memory.Resize(load_bytes);
+  }
+  model_info.ReserveVariables(num_col);
+  model_info.ReserveConstraints(num_row);
+
+  in.ReadArray(model_info.obj_coefficients, num_col);
+  in.ReadArray(model_info.var_lower_bounds, num_col);
+  in.ReadArray(model_info.var_upper_bounds, num_col);
+  std::vector<uint8_t> types;
+  in.ReadArray(types, num_col);
+  model_info.variable_types.reserve(num_col);
+  for (auto type : types) {
+    switch ((SnapshotVarType)type) {
+    case SnapshotVarType::INTEGER:
+      model_info.variable_types.push_back(HighsVariableType::INTEGER);
+      break;
+    case SnapshotVarType::BINARY:
+      model_info.variable_types.push_back(HighsVariableType::BINARY);
+      break;
+    default:
+      model_info.variable_types.push_back(HighsVariableType::CONTINUOUS);
+      break;
+    }
+  }
+  in.ReadArray(model_info.constraint_lower_bounds, num_row);
+  in.ReadArray(model_info.constraint_upper_bounds, num_row);
+
+  std::vector<uint64_t> start;
+  std::vector<int32_t> index;
+  std::vector<double> value;
+  in.ReadArray(start, num_row + 1);
+  in.ReadArray(index, nnz);
+  in.ReadArray(value, nnz);
+  auto &coefficients = model_info.constraint_coefficients;
+  coefficients.Reserve(nnz);
+  for (idx_t row = 0; row < num_row; row++) {
+    if (start[row] > start[row + 1] || start[row + 1] > nnz) {
+      throw std::runtime_error("Snapshot matrix is malformed");
+    }
+    for (idx_t k = start[row]; k < start[row + 1]; k++) {
+      if (index[k] < 0 || (idx_t)index[k] >= num_col) {
+        throw std::runtime_error("Snapshot matrix is malformed");
+      }
+      coefficients.Append((int)row, index[k], value[k]);
+    }
+  }
+
+  switch (model_info.key_type) {
+  case HighsKeyType::NAME:
+    ReadNames(in, num_col, model_info.variable_names, "variable");
+    ReadNames(in, num_row, model_info.constraint_names, "constraint");
+    break;
+  case HighsKeyType::ID:
+    ReadIds(in, num_col, model_info.variable_ids, "variable");
+    ReadIds(in, num_row, model_info.constraint_ids, "constraint");
+    break;
+  default:
+    if (num_col > 0 || num_row > 0) {
+      throw std::runtime_error("Snapshot has no keys");
+    }
+    break;
+  }
+
+  std::vector<std::pair<std::string, std::string>> options;
+  for (idx_t i = 0; i < header.num_options; i++) {
+    std::string name = in.ReadString();
+    options.emplace_back(name, in.ReadString());
+  }
+
+  if (header.has_basis) {
+    std::vector<uint8_t> col_status;
+    std::vector<uint8_t> row_status;
+    in.ReadArray(col_status, num_col);
+    in.ReadArray(row_status, num_row);
+    auto &basis = model_info.start_basis;
+    basis.col_status.resize(num_col);
+    basis.row_status.resize(num_row);
+    for (idx_t col = 0; col < num_col; col++) {
+      basis.col_status[col] = ToBasisStatus(col_status[col]);
+    }
+    for (idx_t row = 0; row < num_row; row++) {
+      basis.row_status[row] = ToBasisStatus(row_status[row]);
+    }
+    basis.valid = true;
+  }
+
+  for (auto &option : options) {
+    model_info.options[option.first] = option.second;
+  }
+  model_info.next_var_index = (int)num_col;
+  model_info.next_constraint_index = (int)num_row;
+  // The staging arrays are gone; keep the charge to what the model holds
+  model_info.model_memory.Resize(model_info.ArrayBytes());
+  stats.num_columns = num_col;
+  stats.num_rows = num_row;
+  stats.num_nonzeros = nnz;
+}
+
+} // namespace
+
+HighsModelFileStats SaveModelSnapshot(ClientContext &context,
+                                      const std::string &path,
+                                      const HighsModelInfo &model_info,
+                                      const HighsBasis *basis) {
+  return SaveModelSnapshot(FileSystem::GetFileSystem(context), path,
+                           model_info, basis);
+}
+
+HighsModelFileStats SaveModelSnapshot(FileSystem &fs, const std::string &path,
+                                      const HighsModelInfo &model_info,
+                                      const HighsBasis *basis) {
+  idx_t num_col = model_info.next_var_index;
+  idx_t num_row = model_info.next_constraint_index;
+  bool has_basis = basis && basis->valid &&
+                   basis->col_status.size() == num_col &&
+                   basis->row_status.size() == num_row;
+
+  // Group the coefficients by row with a counting sort; entries keep their
+  // order within a row and duplicates stay as they are
+  auto &coefficients = model_info.constraint_coefficients;
+  idx_t nnz = coefficients.Size();
+  std::vector<uint64_t> start(num_row + 1, 0);
+  coefficients.ForEach(0, nnz,
+                       [&](int row, int, double) { start[row + 1]++; });
+  for (idx_t row = 0; row < num_row; row++) {
+    start[row + 1] += start[row];
+  }
+  std::vector<int32_t> index(nnz);
+  std::vector<double> value(nnz);
+  {
+    std::vector<uint64_t> position(start.begin(), start.end() - 1);
+    coefficients.ForEach(0, nnz, [&](int row, int col, double coeff) {
+      uint64_t p = position[row]++;
+      index[p] = col;
+      value[p] = coeff;
+    });
+  }
+
+  SnapshotHeader header;
+  std::memset(&header, 0, sizeof(header));
+  std::memcpy(header.magic, kSnapshotMagic, sizeof(kSnapshotMagic));
+  header.version = kSnapshotVersion;
+  header.byte_order = kByteOrderMark;
+  header.key_type = (uint8_t)model_info.key_type;
+  header.maximize = model_info.model.lp_.sense_ == ObjSense::kMaximize;
+  header.has_basis = has_basis;
+  header.offset = model_info.model.lp_.offset_;
+  header.num_columns = num_col;
+  header.num_rows = num_row;
+  header.num_nonzeros = start[num_row];
+  header.num_options = model_info.options.size();
+
+  auto handle = fs.OpenFile(path, FileFlags::FILE_FLAGS_WRITE |
+                                      FileFlags::FILE_FLAGS_FILE_CREATE_NEW);
+  SnapshotWriter out(*handle);
+  out.Write(&header, sizeof(header));
+
+  out.WriteArray(model_info.obj_coefficients);
+  out.WriteArray(model_info.var_lower_bounds);
+  out.WriteArray(model_info.var_upper_bounds);
+  std::vector<uint8_t> types(num_col);
+  for (idx_t col = 0; col < num_col; col++) {
+    HighsVariableType type = model_info.variable_types[col];
+    types[col] = (uint8_t)(type == HighsVariableType::BINARY
+                               ? SnapshotVarType::BINARY
+                           : type == HighsVariableType::INTEGER
+                               ? SnapshotVarType::INTEGER
+                               : SnapshotVarType::CONTINUOUS);
+  }
+  out.WriteArray(types);
+  out.WriteArray(model_info.constraint_lower_bounds);
+  out.WriteArray(model_info.constraint_upper_bounds);
+  out.WriteArray(start);
+  out.WriteArray(index);
+  out.WriteArray(value);
+
+  if (model_info.key_type == HighsKeyType::NAME) {
+    WriteNames(out, model_info.variable_names);
+    WriteNames(out, model_info.constraint_names);
+  } else if (model_info.key_type == HighsKeyType::ID) {
+    out.WriteArray(model_info.variable_ids.Ids());
+    out.WriteArray(model_info.constraint_ids.Ids());
+  }
+
+  for (auto &option : model_info.options) {
+    out.WriteString(option.first);
+    out.WriteString(option.second);
+  }
+
+  if (has_basis) {
+    std::vector<uint8_t> col_status(num_col);
+    std::vector<uint8_t> row_status(num_row);
+    for (idx_t col = 0; col < num_col; col++) {
+      col_status[col] = (uint8_t)basis->col_status[col];
+    }
+    for (idx_t row = 0; row < num_row; row++) {
+      row_status[row] = (uint8_t)basis->row_status[row];
+    }
+    out.WriteArray(col_status);
+    out.WriteArray(row_status);
+  }
+  handle->Sync();
+  handle->Close();
+
+  HighsModelFileStats stats;
+  stats.num_columns = num_col;
+  stats.num_rows = num_row;
+  stats.num_nonzeros = start[num_row];
+  return stats;
+}
+
+HighsModelFileStats LoadModelSnapshot(ClientContext &context,
+                                      const std::string &path,
+                                      HighsModelInfo &model_info) {
+  return LoadModelSnapshot(FileSystem::GetFileSystem(context), path,
+                           model_info);
+}
+
+HighsModelFileStats LoadModelSnapshot(FileSystem &fs, const std::string &path,
+                                      HighsModelInfo &model_info) {
+  auto handle = fs.OpenFile(path, FileFlags::FILE_FLAGS_READ);
+  SnapshotReader in(*handle);
+  HighsModelFileStats stats;
+  try {
+    LoadSnapshot(in, model_info, stats);
+  } catch (...) {
+    model_info.Clear();
+    throw;
+  }
+  return stats;
+}
+
+} // namespace duckdb
@@ -0,0 +1,155 @@
+#include "highs_threading.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
+
+#include <algorithm>
+#include <mutex>
+#include <thread>
+
+namespace duckdb {
+
+namespace {
+
+// Process-wide view of the HiGHS worker pool
+struct HighsThreadCoordinator {
+  std::mutex mutex;
+  idx_t active_solves = 0;
+  HighsInt pool_threads = 0; // 0 until a slot has sized the pool
+
+  static HighsThreadCoordinator &Instance() {
+    static HighsThreadCoordinator instance;
+    return instance;
+  }
+};
+
+} // namespace
+
+void ValidateHighsOption(const std::string &name, const std::string &value) {
+  Highs probe;
+  probe.setOptionValue("output_flag", false);
+  if (probe.setOptionValue(name, value) != HighsStatus::kOk) {
+    throw std::runtime_error("Invalid HiGHS option '" + name +
+                             "' with value '" + value + "'");
+  }
+}
+
+void ApplyHighsOptions(Highs &highs, const HighsOptionProfile &profile) {
+  highs.resetOptions();
+  for (const auto &option : profile) {
+    if (option.first == "threads") {
+      continue;
+    }
+    if (highs.setOptionValue(option.first, option.second) != HighsStatus::kOk) {
+      throw std::runtime_error("Invalid HiGHS option '" + option.first +
+                               "' with value '" + option.second + "'");
+    }
+  }
+}
+
+void SetHighsThreadingMode(ClientContext &context, SetScope scope,
+                           Value &parameter) {
+  auto mode = StringUtil::Lower(parameter.ToString());
+  if (mode != "auto" && mode != "duckdb" && mode != "highs") {
+    throw InvalidInputException(
+        "highs_threading must be one of 'auto', 'duckdb' or 'highs'");
+  }
+  parameter = Value(mode);
+}
+
+HighsThreadSettings HighsThreadSettings::FromContext(ClientContext &context) {
+  HighsThreadSettings settings;
+  Value mode;
+  if (context.TryGetCurrentSetting("highs_threading", mode) &&
+      !mode.IsNull()) {
+    settings.mode = StringUtil::Lower(mode.ToString());
+  }
+  settings.duckdb_threads = MaxValue<idx_t>(
+      1, (idx_t)TaskScheduler::GetScheduler(context).NumberOfThreads());
+  return settings;
+}
+
+HighsSolveSlot::HighsSolveSlot(ClientContext &context, Highs &highs,
+                               const HighsOptionProfile &profile,
+                               idx_t concurrent_solves)
+    : HighsSolveSlot(HighsThreadSettings::FromContext(context), highs, profile,
+                     concurrent_solves) {}
+
+// Width for the given number of solves in flight, this one included
+static idx_t WidthFor(const HighsThreadSettings &settings,
+                      const HighsOptionProfile &profile, idx_t solves) {
+  const std::string &mode = settings.mode;
+  if (mode == "duckdb") {
+    return 1;
+  }
+  if (mode == "highs") {
+    return MaxValue<idx_t>(1, (std::thread::hardware_concurrency() + 1) / 2);
+  }
+  // The thread that calls run() works alongside the pool, so each other
+  // solve in flight takes one worker away
+  idx_t others = solves - 1;
+  idx_t width = settings.duckdb_threads > others
+                    ? settings.duckdb_threads - others
+                    : 1;
+  auto it = profile.find("threads");
+  if (it != profile.end()) {
+    int requested = std::stoi(it->second);
+    if (requested > 0) {
+      width = MinValue<idx_t>(width, (idx_t)requested);
+    }
+  }
+  return width;
+}
+
+idx_t HighsSolveWidth(const HighsThreadSettings &settings,
+                      const HighsOptionProfile &profile,
+                      idx_t concurrent_solves) {
+  auto &coordinator = HighsThreadCoordinator::Instance();
+  idx_t solves;
+  {
+    std::lock_guard<std::mutex> guard(coordinator.mutex);
+    solves = coordinator.active_solves + 1;
+  }
+  return WidthFor(settings, profile, MaxValue(solves, concurrent_solves));
+}
+
+HighsSolveSlot::HighsSolveSlot(const HighsThreadSettings &settings,
+                               Highs &highs, const HighsOptionProfile &profile,
+                               idx_t concurrent_solves) {
+  HighsInt pool_threads;
+  {
+    auto &coordinator = HighsThreadCoordinator::Instance();
+    std::lock_guard<std::mutex> guard(coordinator.mutex);
+    idx_t solves =
+        MaxValue<idx_t>(coordinator.active_solves + 1, concurrent_solves);
+    width = WidthFor(settings, profile, solves);
+    if (coordinator.active_solves == 0 &&
+        coordinator.pool_threads != (HighsInt)width) {
+      Highs::resetGlobalScheduler(true);
+      coordinator.pool_threads = (HighsInt)width;
+    }
+    pool_threads = coordinator.pool_threads;
+    width = MinValue<idx_t>(width, (idx_t)pool_threads);
+    coordinator.active_solves++;
+  }
+
+  // Every run must name the pool's size; a narrower width is applied
+  // through the run's own parallelism options
+  highs.setOptionValue("threads", pool_threads);
+  if (width == 1) {
+    highs.setOptionValue("parallel", "off");
+  } else {
+    HighsInt concurrency = 0;
+    highs.getOptionValue("simplex_max_concurrency", concurrency);
+    if ((idx_t)concurrency > width) {
+      highs.setOptionValue("simplex_max_concurrency", (HighsInt)width);
+    }
+  }
+}
+
+HighsSolveSlot::~HighsSolveSlot() {
+  auto &coordinator = HighsThreadCoordinator::Instance();
+  std::lock_guard<std::mutex> guard(coordinator.mutex);
+  coordinator.active_solves--;
+}
+
+} // namespace duckdb
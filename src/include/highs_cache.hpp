@@ -0,0 +1,71 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "duckdb/main/config.hpp"
+#include "highs_model.hpp"
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace duckdb {
+
+// Counters reported by highs_cache_stats()
+struct HighsResultCacheStats {
+  idx_t entries = 0;
+  idx_t capacity = 0;
+  idx_t hits = 0;
+  idx_t misses = 0;
+  idx_t evictions = 0;
+};
+
+// Process-wide LRU cache of solve results keyed on the model fingerprint
+// (HighsModelInfo::Fingerprint): indexed on its hash, and a hit only when
+// the dimensions and check value match as well. So a solve of any model
+// whose LP and options match an earlier one - the same model edited back,
+// or a copy of it - reuses that result. Holds up to Capacity() results; 0
+// disables it.
+// Interrupted results are never stored.
+class HighsResultCache {
+public:
+  static constexpr idx_t kDefaultCapacity = 32;
+
+  static HighsResultCache &Instance();
+
+  // Cached result for the fingerprint, counted as a hit or a miss. An
+  // entry with the same hash but a different fingerprint is a miss.
+  std::shared_ptr<const HighsSolveResult>
+  Lookup(const HighsFingerprint &fingerprint);
+
+  // Replaces any entry with the same hash
+  void Insert(const HighsFingerprint &fingerprint,
+              std::shared_ptr<const HighsSolveResult> result);
+
+  // Evicts the least recently used results beyond the new capacity
+  void SetCapacity(idx_t capacity);
+
+  HighsResultCacheStats Stats();
+
+private:
+  HighsResultCache() = default;
+
+  void EvictBeyond(idx_t capacity);
+
+  using Entry =
+      std::pair<HighsFingerprint, std::shared_ptr<const HighsSolveResult>>;
+
+  std::mutex mutex;
+  idx_t capacity = kDefaultCapacity;
+  std::list<Entry> entries; // most recently used first
+  std::unordered_map<uint64_t, std::list<Entry>::iterator> index;
+  idx_t hits = 0;
+  idx_t misses = 0;
+  idx_t evictions = 0;
+};
+
+// Apply a value of the highs_result_cache_size setting
+void SetHighsResultCacheSize(ClientContext &context, SetScope scope,
+                             Value &parameter);
+
+} // namespace duckdb
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "highs_model.hpp"
+#include "highs_threading.hpp"
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace duckdb {
+
+// Variables and constraints of one independent sub-problem, as model
+// indices in ascending order
+struct HighsBlock {
+  std::vector<int> columns;
+  std::vector<int> rows;
+};
+
+// Split the model into the connected components of its variable-constraint
+// graph. Components smaller than min_block_size (columns plus nonzeros) are
+// packed together, so a model of many tiny regions does not turn into as
+// many HiGHS runs; the blocks are still independent of each other.
+// Constraints without coefficients go into the first block. The caller
+// must hold the model mutex, shared or exclusive.
+std::vector<HighsBlock> FindModelBlocks(const HighsModelInfo &model_info,
+                                        idx_t min_block_size);
+
+// Blocks below this many columns plus nonzeros are packed together by
+// default; a HiGHS run has fixed costs that dwarf solving a handful of rows
+constexpr idx_t kDefaultMinBlockSize = 1024;
+
+// Blocks of a decomposed solve handed out to its threads so far, read by
+// the progress bar while the solve runs
+struct HighsBlockProgress {
+  std::atomic<idx_t> num_blocks{0}; // 0 until the blocks are found
+  std::atomic<idx_t> next_block{0};
+
+  // Fraction of the blocks started, 0 before there are any
+  double Fraction() const {
+    idx_t total = num_blocks.load();
+    if (total == 0) {
+      return 0;
+    }
+    return (double)MinValue<idx_t>(next_block.load(), total) / (double)total;
+  }
+};
+
+// Solve the model block by block on up to settings.duckdb_threads threads
+// and merge the solutions back into model order. The objective is the sum
+// of the blocks' objectives plus the model offset, and the status is the
+// worst of theirs. The result is not cached and the model's live solver is
+// left alone, but the solve is profiled in the model's solve_log. Stops
+// early, as interrupted, once *interrupted is set. Blocks are handed out
+// through progress, if given.
+std::shared_ptr<const HighsSolveResult>
+SolveModelDecomposed(HighsModelInfo &model_info,
+                     const HighsThreadSettings &settings,
+                     idx_t min_block_size = kDefaultMinBlockSize,
+                     const std::atomic<bool> *interrupted = nullptr,
+                     HighsBlockProgress *progress = nullptr);
+
+} // namespace duckdb
@@ -0,0 +1,109 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "highs_model.hpp"
+#include "highs_monitor.hpp"
+#include "highs_threading.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace duckdb {
+
+enum class HighsJobState : uint8_t {
+  QUEUED,
+  RUNNING,
+  FINISHED,
+  FAILED,
+  CANCELLED
+};
+
+const char *JobStateToString(HighsJobState state);
+
+// One background solve (highs_solve_async)
+struct HighsJob {
+  int64_t job_id = 0;
+  std::string model_name;
+  std::shared_ptr<HighsModelInfo> model_info;
+  HighsThreadSettings settings; // of the submitting connection
+  HighsRunMonitor monitor;
+
+  // Guarded by the manager mutex
+  HighsJobState state = HighsJobState::QUEUED;
+  std::chrono::steady_clock::time_point started;
+  std::chrono::steady_clock::time_point finished;
+  std::shared_ptr<const HighsSolveResult> result;
+  std::string error;
+};
+
+// A job as reported by highs_jobs
+struct HighsJobInfo {
+  int64_t job_id;
+  std::string model_name;
+  HighsJobState state;
+  HighsModelStatus model_status; // kNotset until the run ends
+  double objective_value;        // NaN until known
+  double mip_gap;                // NaN until known
+  double runtime_seconds;        // 0 while queued
+  std::string error;
+};
+
+// Runs background solves on a bounded pool of worker threads, started as
+// jobs arrive. Jobs and their results stay listed after they end, so any
+// connection can collect them later, until they are cancelled or until
+// kMaxEndedJobs newer jobs have ended.
+class HighsJobManager {
+public:
+  static constexpr idx_t kMaxEndedJobs = 1000;
+
+  static HighsJobManager &Instance();
+  ~HighsJobManager();
+
+  // Queue a solve of the model and return its job id
+  int64_t Submit(const std::string &model_name,
+                 std::shared_ptr<HighsModelInfo> model_info,
+                 const HighsThreadSettings &settings);
+
+  std::vector<HighsJobInfo> List();
+
+  // Stop a queued or running job, or forget a finished one along with its
+  // result. Returns the job's state before the call; throws for unknown
+  // jobs.
+  HighsJobState Cancel(int64_t job_id);
+
+  // Result of a finished (or interrupted) job; throws if there is none
+  std::shared_ptr<const HighsSolveResult> Result(int64_t job_id);
+
+  // Block until the job has ended and return its final state. Throws
+  // InterruptException once the interrupted flag is raised.
+  HighsJobState Wait(int64_t job_id, const std::atomic<bool> &interrupted);
+
+private:
+  HighsJobManager();
+
+  void WorkerLoop();
+  std::shared_ptr<HighsJob> FindJob(int64_t job_id);
+  // Record that a job has ended and forget the oldest ended jobs beyond
+  // kMaxEndedJobs. The caller must hold the mutex.
+  void JobEnded(int64_t job_id);
+
+  std::mutex mutex;
+  std::condition_variable work_available;
+  std::condition_variable job_ended;
+  std::map<int64_t, std::shared_ptr<HighsJob>> jobs;
+  std::deque<std::shared_ptr<HighsJob>> queue;
+  std::deque<int64_t> ended; // ids of ended jobs still listed, oldest first
+  std::vector<std::thread> workers;
+  idx_t max_workers;
+  idx_t idle_workers = 0;
+  int64_t next_job_id = 1;
+  bool shutdown = false;
+};
+
+} // namespace duckdb
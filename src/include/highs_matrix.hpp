@@ -0,0 +1,123 @@
+#pragma once
+
+#include "util/HighsInt.h"
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace duckdb {
+
+// Constraint coefficients as coordinate (row, col, value) triplets in
+// structure-of-arrays layout, in append order. Entries live in chunks that
+// never move once allocated: appending never copies what is stored, and
+// there is no allocation per constraint. Chunks start small and double up
+// to kMaxChunkSize entries, so a tiny model stays tiny. Duplicate (row,
+// col) entries are kept; they are summed when the matrix is assembled.
+class HighsCoefficientStore {
+public:
+  static constexpr size_t kMinChunkSize = 256;
+  static constexpr size_t kMaxChunkSize = size_t(1) << 16;
+
+  size_t Size() const { return size; }
+
+  void Append(int row, int col, double value) {
+    if (size == Capacity()) {
+      AddChunk();
+    }
+    if (size == chunks[active].end) {
+      active++;
+    }
+    Chunk &chunk = chunks[active];
+    size_t k = size - chunk.begin;
+    chunk.row[k] = row;
+    chunk.col[k] = col;
+    chunk.value[k] = value;
+    size++;
+  }
+
+  // Append count triplets from parallel arrays, a chunk at a time
+  void Append(const int *row, const int *col, const double *value,
+              size_t count);
+
+  // Make room for count more entries
+  void Reserve(size_t count);
+  // Bytes of the chunks Reserve(count) would allocate
+  size_t ReserveBytes(size_t count) const;
+
+  // Drop every entry and free the chunks
+  void Clear();
+
+  size_t AllocatedBytes() const;
+
+  // Call func(row, col, value) on the entries in [begin, end)
+  template <class FUNC>
+  void ForEach(size_t begin, size_t end, FUNC &&func) const {
+    for (size_t c = FindChunk(begin); begin < end; c++) {
+      const Chunk &chunk = chunks[c];
+      size_t chunk_end = end < chunk.end ? end : chunk.end;
+      for (size_t k = begin - chunk.begin; k < chunk_end - chunk.begin;
+           k++) {
+        func(chunk.row[k], chunk.col[k], chunk.value[k]);
+      }
+      begin = chunk_end;
+    }
+  }
+
+private:
+  struct Chunk {
+    size_t begin; // position of the chunk's first entry
+    size_t end;   // one past the last position it has room for
+    std::unique_ptr<int[]> row;
+    std::unique_ptr<int[]> col;
+    std::unique_ptr<double[]> value;
+  };
+
+  size_t Capacity() const { return chunks.empty() ? 0 : chunks.back().end; }
+  // Entries of the chunk after one of last_entries (0: the first chunk)
+  static size_t NextChunkSize(size_t last_entries);
+  void AddChunk();
+  size_t FindChunk(size_t position) const;
+
+  std::vector<Chunk> chunks;
+  size_t active = 0; // the chunk the next entry goes to, once it has one
+  size_t size = 0;
+};
+
+// Column-wise (CSC) constraint matrix in the layout HiGHS expects for
+// HighsSparseMatrix with MatrixFormat::kColwise. Also holds row-wise (CSR)
+// matrices, with start indexed by row and index holding columns.
+struct HighsColwiseMatrix {
+  std::vector<HighsInt> start;
+  std::vector<HighsInt> index;
+  std::vector<double> value;
+};
+
+// Sort stored coefficients into CSC with two stable counting sorts, by row
+// and then by column, so every column comes out sorted by row without a
+// comparison sort. Runs in O(nnz + (num_row + num_col) * num_threads),
+// where num_row is one past the largest row index; duplicate (row, col)
+// entries are summed and zeros are dropped on the way. num_threads threads
+// are started for the call (callers pass HighsSolveWidth, the budget the
+// solve itself gets), and only for at least 64Ki entries.
+void AssembleColwiseMatrix(HighsInt num_col,
+                           const HighsCoefficientStore &coefficients,
+                           HighsColwiseMatrix &result,
+                           size_t num_threads = 1);
+
+// Same as above for unordered coordinate (row, col, value) triplets in
+// plain arrays
+void AssembleColwiseMatrix(HighsInt num_col, const int *row_index,
+                           const int *col_index, const double *value,
+                           size_t nnz, HighsColwiseMatrix &result,
+                           size_t num_threads = 1);
+
+// Row-wise (CSR) counterpart for the stored entries from position begin on
+// that fall in rows [first_row, first_row + num_row): result.start is
+// indexed by row - first_row and result.index holds columns. Entries of
+// earlier rows are skipped. Duplicates are summed and zeros dropped.
+void AssembleRowwiseMatrix(HighsInt first_row, HighsInt num_row,
+                           const HighsCoefficientStore &coefficients,
+                           size_t begin, HighsColwiseMatrix &result);
+
+} // namespace duckdb
@@ -0,0 +1,92 @@
+#pragma once
+
+#include "duckdb.hpp"
+
+#include <memory>
+#include <string>
+
+namespace duckdb {
+
+struct HighsModelInfo;
+
+// Bytes charged to a database's buffer pool on behalf of memory the
+// extension allocates itself. The charge counts against memory_limit like
+// DuckDB's own buffers and shows under the EXTENSION tag of
+// duckdb_memory(). Growing it makes the buffer pool evict or spill buffers
+// to make room, and throws OutOfMemoryException if it cannot. Released on
+// destruction; a charge on a database that has since closed is dropped.
+// Not thread-safe: whoever owns the charge serialises access to it.
+class HighsMemoryCharge {
+public:
+  HighsMemoryCharge() = default;
+  ~HighsMemoryCharge();
+
+  HighsMemoryCharge(HighsMemoryCharge &&other) noexcept;
+  HighsMemoryCharge &operator=(HighsMemoryCharge &&other) noexcept;
+  HighsMemoryCharge(const HighsMemoryCharge &) = delete;
+  HighsMemoryCharge &operator=(const HighsMemoryCharge &) = delete;
+
+  // Charge the context's database from now on, moving what is already
+  // charged elsewhere over to it
+  void Attach(ClientContext &context);
+  // Charge the same database as another charge
+  void Attach(const HighsMemoryCharge &other);
+
+  // Set the number of bytes charged. On failure the charge is unchanged.
+  // Without a database nothing is charged.
+  void Resize(idx_t bytes);
+
+  idx_t Bytes() const { return bytes; }
+
+private:
+  void Release() noexcept;
+
+  std::weak_ptr<DatabaseInstance> db;
+  idx_t bytes = 0;
+};
+
+// Bytes a solve of an LP of this size holds on to: HiGHS's copy of the
+// LP, with the matrix a second time as the simplex solver also keeps it
+// row-wise, and the result's values and keys. Workspaces of the run itself
+// are not included.
+idx_t EstimateSolveBytes(idx_t num_columns, idx_t num_rows,
+                         idx_t num_nonzeros);
+
+// Charge the model's arrays, plus extra_bytes about to be added to them,
+// to the context's database. Loaders call it before they grow the arrays,
+// with the growth as extra_bytes, so a load that would take the database
+// past memory_limit fails with an out-of-memory error instead of the
+// process being killed. The caller must hold the model mutex
+// exclusively.
+void ChargeModelMemory(ClientContext &context, HighsModelInfo &model_info,
+                       idx_t extra_bytes = 0);
+
+// Make room for count variables or constraints in the model's arrays
+// (HighsModelInfo::ReserveVariables / ReserveConstraints), charging the
+// growth before it is allocated. A batch that does not fit under
+// memory_limit fails with the model unchanged. The caller must hold the
+// model mutex exclusively.
+void ReserveModelVariables(ClientContext &context, HighsModelInfo &model_info,
+                           idx_t count);
+void ReserveModelConstraints(ClientContext &context,
+                             HighsModelInfo &model_info, idx_t count);
+
+// Write a model to a snapshot file under directory and drop its arrays,
+// live solver and last result, releasing their charges. Its options and
+// solve log stay. Returns the bytes released. The caller must hold the
+// model mutex exclusively and must have marked the model spilled. Throws,
+// leaving the model as it is, if a solve holds its solver_mutex.
+idx_t SpillModel(FileSystem &fs, const std::string &directory,
+                 HighsModelInfo &model_info);
+
+// Read a spilled model back from its file. The registry calls this on
+// every lookup of a spilled model, so users never see one; it takes the
+// model mutex exclusively and does nothing if the model is resident again.
+// The model's charge is reserved before the file is read, so a restore
+// that does not fit fails and leaves the model spilled. Models outlive the
+// database whose temp directory they spilled to, and DuckDB deletes that
+// directory when the database closes; if the file is gone, the model is
+// left empty (keeping its options and solve log) and an error is thrown.
+void RestoreSpilledModel(HighsModelInfo &model_info);
+
+} // namespace duckdb
@@ -0,0 +1,471 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "highs_matrix.hpp"
+#include "highs_memory.hpp"
+#include "highs_monitor.hpp"
+#include "highs_names.hpp"
+#include "highs_profile.hpp"
+#include "highs_threading.hpp"
+
+// HiGHS headers
+#include "Highs.h"
+
+#include <atomic>
+#include <unordered_map>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+
+namespace duckdb {
+
+// Reader/writer lock for one model. Writers take it with std::unique_lock
+// or std::lock_guard; readers use HighsSharedLock. A waiting writer holds
+// off new readers, so loaders are not starved by a stream of solves.
+// (std::shared_mutex is C++17; extensions are built as C++11.)
+class HighsModelLock {
+public:
+  void lock() {
+    std::unique_lock<std::mutex> guard(mutex_);
+    waiting_writers_++;
+    changed_.wait(guard, [this]() { return !writer_ && readers_ == 0; });
+    waiting_writers_--;
+    writer_ = true;
+    version_++;
+  }
+
+  void unlock() {
+    {
+      std::lock_guard<std::mutex> guard(mutex_);
+      writer_ = false;
+    }
+    changed_.notify_all();
+  }
+
+  void lock_shared() {
+    std::unique_lock<std::mutex> guard(mutex_);
+    changed_.wait(guard,
+                  [this]() { return !writer_ && waiting_writers_ == 0; });
+    readers_++;
+  }
+
+  void unlock_shared() {
+    bool last;
+    {
+      std::lock_guard<std::mutex> guard(mutex_);
+      last = --readers_ == 0;
+    }
+    if (last) {
+      changed_.notify_all();
+    }
+  }
+
+  // Number of exclusive acquisitions so far. Every change to a model is
+  // made under the exclusive lock, so a result solved at one version is
+  // current for as long as the version stays the same. Read it while
+  // holding the lock, shared or exclusive.
+  uint64_t Version() const { return version_; }
+
+private:
+  std::mutex mutex_;
+  std::condition_variable changed_;
+  uint64_t version_ = 0;
+  size_t readers_ = 0;
+  size_t waiting_writers_ = 0;
+  bool writer_ = false;
+};
+
+// Scoped shared hold on a HighsModelLock; can be released early or moved
+// to another lock
+class HighsSharedLock {
+public:
+  HighsSharedLock() {}
+  explicit HighsSharedLock(HighsModelLock &lock) { Lock(lock); }
+  ~HighsSharedLock() { Unlock(); }
+
+  HighsSharedLock(const HighsSharedLock &) = delete;
+  HighsSharedLock &operator=(const HighsSharedLock &) = delete;
+
+  void Lock(HighsModelLock &lock) {
+    Unlock();
+    lock.lock_shared();
+    lock_ = &lock;
+  }
+
+  void Unlock() {
+    if (lock_) {
+      lock_->unlock_shared();
+      lock_ = nullptr;
+    }
+  }
+
+private:
+  HighsModelLock *lock_ = nullptr;
+};
+
+// Type of a variable, one byte per variable in the model arrays. Type
+// names ('continuous', 'integer', 'binary') only appear at the SQL and file
+// boundaries; any other name is continuous.
+enum class HighsVariableType : uint8_t { CONTINUOUS, INTEGER, BINARY };
+
+// How a model's variables and constraints are keyed. The first loader
+// decides; a model is keyed by names or by BIGINT ids, never both.
+enum class HighsKeyType : uint8_t { UNSET, NAME, ID };
+
+struct HighsModelInfo;
+
+// Variable or constraint keys of a model as of a solve, for emitting results
+// after the model lock is released. Names point into the (shared) arena.
+struct HighsKeySnapshot {
+  idx_t count = 0;
+  std::vector<string_t> names; // empty for id-keyed models
+  buffer_ptr<HighsNameArena> name_arena;
+  std::vector<int64_t> ids; // empty for name-keyed models
+
+  // The caller must hold the model mutex, shared or exclusive
+  void SnapshotColumns(const HighsModelInfo &model_info);
+  void SnapshotRows(const HighsModelInfo &model_info);
+  void SnapshotNames(const HighsNameTable &table);
+
+  // Caller id for id-keyed models, otherwise the index
+  int64_t Id(idx_t index) const {
+    return ids.empty() ? (int64_t)index : ids[index];
+  }
+};
+
+// Outcome of one solve: primal and dual values for columns and rows, under
+// the keys the model had at the time. Published as a shared_ptr to const,
+// so any number of scans can read it while the model moves on.
+struct HighsSolveResult {
+  uint64_t model_version = 0; // HighsModelLock::Version() solved at
+  uint64_t solve_id = 0;      // entry in the model's solve_log
+  HighsModelStatus model_status = HighsModelStatus::kNotset;
+  double objective_value = 0.0;
+  HighsKeySnapshot columns;
+  HighsKeySnapshot rows;
+  // Sized to columns.count and rows.count, zero where HiGHS has no value
+  std::vector<double> col_value;
+  std::vector<double> col_dual;
+  std::vector<double> row_value;
+  std::vector<double> row_dual;
+  // Distance from the activity to the nearest finite row bound; infinite
+  // for free rows
+  std::vector<double> row_slack;
+};
+
+// Key of the LP a solve would see (HighsModelInfo::Fingerprint). The
+// result cache is indexed on hash; on a hit the rest must match too, so
+// two LPs whose 64-bit hashes happen to collide are not confused.
+struct HighsFingerprint {
+  uint64_t hash = 0;
+  // Independently mixed sum of the same content, plus options
+  uint64_t check = 0;
+  idx_t num_columns = 0;
+  idx_t num_rows = 0;
+  idx_t num_nonzeros = 0;
+
+  bool operator==(const HighsFingerprint &other) const {
+    return hash == other.hash && check == other.check &&
+           num_columns == other.num_columns && num_rows == other.num_rows &&
+           num_nonzeros == other.num_nonzeros;
+  }
+};
+
+// Model registry to store HiGHS models and their metadata
+struct HighsModelInfo {
+  HighsModel model;
+  HighsKeyType key_type = HighsKeyType::UNSET;
+  HighsNameTable variable_names;   // name <-> variable index
+  HighsNameTable constraint_names; // name <-> constraint index
+  HighsIdMap variable_ids;         // id <-> variable index
+  HighsIdMap constraint_ids;       // id <-> constraint index
+  std::vector<double> obj_coefficients;
+  std::vector<double> var_lower_bounds;
+  std::vector<double> var_upper_bounds;
+  std::vector<double> constraint_lower_bounds;
+  std::vector<double> constraint_upper_bounds;
+  // {constraint_idx, var_idx, coeff} triplets
+  HighsCoefficientStore constraint_coefficients;
+  std::vector<HighsVariableType> variable_types;
+  int next_var_index = 0;
+  int next_constraint_index = 0;
+  // Sum of the hashes of every variable, constraint and coefficient, kept
+  // up to date by the Fingerprint* calls of whoever edits the arrays. A sum
+  // (rather than a rolling hash) lets an edit swap one term in O(1).
+  uint64_t content_hash = 0;
+  // The same sum with every term hashed again, checked on cache hits
+  uint64_t content_check = 0;
+  // Loaders and edits take this exclusively; solves and other readers share
+  // it, so they only wait for writers to the same model
+  HighsModelLock mutex;
+
+  // Live solver holding the model as of the last solve. Edits made after
+  // that are sent to it as deltas, so a re-solve starts from the previous
+  // basis (LP) or incumbent (MIP) instead of from scratch. solver_mutex
+  // serialises solves of this model; it is taken before the shared lock and
+  // guards the solver, the synced_* fields and last_result below. Timed, so
+  // solves queued behind a long one can give up when interrupted (see
+  // LockSolver).
+  std::timed_mutex solver_mutex;
+  unique_ptr<Highs> solver;
+  int synced_num_col = 0;
+  int synced_num_row = 0;
+  size_t synced_nnz = 0;              // coefficients already in the solver
+  std::vector<int> dirty_variables;   // bounds/cost changed since last sync
+  std::vector<int> dirty_constraints; // bounds changed since last sync
+  // Result of the last solve; current while its model_version matches
+  std::shared_ptr<const HighsSolveResult> last_result;
+  // Basis loaded from a snapshot, handed to the solver when it is built
+  HighsBasis start_basis;
+
+  // Options applied to every solve of this model (highs_set_option)
+  HighsOptionProfile options;
+
+  // Timings and HiGHS counters of the recent solves (highs_solve_profile)
+  HighsSolveLog solve_log;
+
+  // Memory charged to the database the model was last loaded through
+  // (highs_memory): the arrays, by loaders under the exclusive lock, and
+  // the live solver and last result, by solves under solver_mutex
+  HighsMemoryCharge model_memory;
+  HighsMemoryCharge solver_memory;
+  // Steady-clock milliseconds of the last registry lookup
+  std::atomic<int64_t> last_used_ms{0};
+  // Set while the arrays live in spill_path instead of memory
+  // (highs_spill_models); spilled_bytes is what they took up
+  std::atomic<bool> spilled{false};
+  std::string spill_path;
+  idx_t spilled_bytes = 0;
+
+  HighsModelInfo() {
+    model.lp_.sense_ = ObjSense::kMinimize;
+    Touch();
+  }
+  ~HighsModelInfo();
+
+  void Touch();
+  double IdleSeconds() const;
+
+  // Bytes held by the model arrays, from their capacities. Constant time,
+  // so loaders can call it for every batch. The caller must hold the model
+  // mutex, shared or exclusive.
+  idx_t ArrayBytes() const;
+
+  // Make room for count variables in every variable array and in the
+  // model's key table, growing capacities geometrically (GrownCapacity).
+  // The caller must hold the model mutex exclusively.
+  void ReserveVariables(idx_t count);
+  // The same for count constraints
+  void ReserveConstraints(idx_t count);
+  // Bytes ReserveVariables(count) / ReserveConstraints(count) would add,
+  // so the growth can be charged before it is allocated. Names interned
+  // afterwards may still grow the name arena.
+  idx_t ReserveVariablesBytes(idx_t count) const;
+  idx_t ReserveConstraintsBytes(idx_t count) const;
+
+  // Fix the model's key type on first use and throw if a loader uses the
+  // other one. The caller must hold the model mutex exclusively.
+  void ClaimKeyType(HighsKeyType type, const std::string &model_name);
+
+  // Drop all variables, constraints and keys and free their memory, keeping
+  // options. Used to back out of a failed file load and to spill a model.
+  // The caller must hold the model mutex exclusively.
+  void Clear();
+
+  // Add (sign +1) or remove (sign -1) the current values of a variable or
+  // constraint in content_hash and content_check. Edits remove before and
+  // add after changing values; new elements are only added. The caller must
+  // hold the model mutex exclusively.
+  void FingerprintVariable(int var_index, int sign);
+  void FingerprintConstraint(int constraint_index, int sign);
+  void FingerprintCoefficient(int constraint_index, int var_index,
+                              double value);
+  // Recompute the content sums from scratch, after a bulk load from a file
+  void RebuildFingerprint();
+
+  // Key of the LP a solve would see: the content sums combined with the
+  // dimensions, objective sense and offset, and the option profile. The
+  // caller must hold the model mutex, shared or exclusive.
+  HighsFingerprint Fingerprint() const;
+
+  // Record an in-place edit of an existing variable or constraint. The
+  // caller must hold the model mutex exclusively.
+  void MarkVariableDirty(int var_index);
+  void MarkConstraintDirty(int constraint_index);
+
+  // Assemble the full LP from the model arrays. The caller must hold the
+  // model mutex, shared or exclusive.
+  HighsLp AssembleLp(size_t num_threads) const;
+
+  // Bring the solver up to date with the model: a full build on first use,
+  // deltas (addCols, addRows, changeCoeff, change*Bounds, ...) afterwards.
+  // The caller must hold solver_mutex and the model mutex (shared is
+  // enough: writers, the only other users of the dirty lists, are excluded).
+  // The time taken goes into the profile's assembly and passModel times.
+  Highs &SyncSolver(size_t num_threads, HighsSolveProfile *profile = nullptr);
+
+private:
+  void BuildSolver(size_t num_threads, HighsSolveProfile *profile);
+  void ApplyDeltas();
+};
+
+// Registry of models by name. Names are hashed onto independently locked
+// shards, so connections working on different models rarely meet on the
+// same lock; the shard lock only covers the map itself. Models are handed
+// out as shared_ptr, so a model dropped mid-query stays valid for the
+// queries still using it. Lookups mark a model used and bring it back
+// first if it was spilled.
+class HighsModelRegistry {
+private:
+  static constexpr size_t kNumShards = 64;
+
+  struct Shard {
+    std::mutex mutex;
+    std::unordered_map<std::string, std::shared_ptr<HighsModelInfo>> models;
+  };
+  Shard shards[kNumShards];
+
+  Shard &GetShard(const std::string &model_name) {
+    return shards[std::hash<std::string>()(model_name) % kNumShards];
+  }
+
+public:
+  static HighsModelRegistry &Instance() {
+    static HighsModelRegistry instance;
+    return instance;
+  }
+
+  std::shared_ptr<HighsModelInfo>
+  GetOrCreateModel(const std::string &model_name) {
+    auto &shard = GetShard(model_name);
+    std::shared_ptr<HighsModelInfo> model;
+    {
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      auto &entry = shard.models[model_name];
+      if (!entry) {
+        entry = std::make_shared<HighsModelInfo>();
+      }
+      model = entry;
+    }
+    return Resident(std::move(model));
+  }
+
+  std::shared_ptr<HighsModelInfo> GetModel(const std::string &model_name) {
+    auto &shard = GetShard(model_name);
+    std::shared_ptr<HighsModelInfo> model;
+    {
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      auto it = shard.models.find(model_name);
+      if (it == shard.models.end()) {
+        return nullptr;
+      }
+      model = it->second;
+    }
+    return Resident(std::move(model));
+  }
+
+  // Every model by name, as they are: not marked used, nor restored
+  std::vector<std::pair<std::string, std::shared_ptr<HighsModelInfo>>> List();
+
+  // Call spill(name, model) on every model that is not spilled, that no
+  // query or job holds and that has not been looked up for idle_seconds,
+  // with the model mutex held exclusively. Such a model is marked spilled
+  // before its shard is unlocked, so a lookup racing with spill waits for
+  // it and then restores the model; spill clears the mark if it leaves the
+  // model in memory.
+  void SpillIdleModels(
+      double idle_seconds,
+      const std::function<void(const std::string &, HighsModelInfo &)>
+          &spill);
+
+  void RemoveModel(const std::string &model_name) {
+    auto &shard = GetShard(model_name);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    shard.models.erase(model_name);
+  }
+
+private:
+  static std::shared_ptr<HighsModelInfo>
+  Resident(std::shared_ptr<HighsModelInfo> model) {
+    model->Touch();
+    if (model->spilled) {
+      RestoreSpilledModel(*model);
+    }
+    return model;
+  }
+};
+
+// Take the model's solver_mutex, which another solve may hold for as long
+// as it runs. While waiting, the monitor (if any) is checked every 50 ms,
+// and InterruptException is thrown once it asks to stop.
+std::unique_lock<std::timed_mutex> LockSolver(HighsModelInfo &model_info,
+                                              const HighsRunMonitor *monitor);
+
+// Run HiGHS on the model it holds and keep its primal and dual values in
+// the result, whose column and row keys must already be set. An
+// interrupted run is not an error; its status says so.
+void RunHighs(Highs &highs, HighsSolveResult &result);
+
+// Solve a registered model, or return the result of its last solve if the
+// model has not been changed since. Every solution scan and background job
+// goes through here, so all results for one model state come from a single
+// solve. Interrupted runs are returned but not kept. Each solve, including
+// one answered from the result cache, is profiled in the model's solve_log.
+std::shared_ptr<const HighsSolveResult>
+SolveModel(HighsModelInfo &model_info, const HighsThreadSettings &settings,
+           HighsRunMonitor *monitor = nullptr);
+
+// Sensitivity of an optimal LP basis, under the keys the model had when it
+// was computed. ranging is only filled when model_status is optimal.
+struct HighsRangingResult {
+  HighsModelStatus model_status = HighsModelStatus::kNotset;
+  double objective_value = 0.0;
+  HighsKeySnapshot columns;
+  HighsKeySnapshot rows;
+  std::vector<double> col_value;
+  std::vector<double> row_value;
+  HighsRanging ranging;
+};
+
+// Cost and bound ranging (Highs::getRanging) of a registered LP: for each
+// column its cost range, and for each column and row its bound range, over
+// which the current basis stays optimal, with the objective at both ends.
+// Uses the basis the live solver holds from the last solve; the solver is
+// only run if it has none for the model as it is now, e.g. after a cache
+// hit. Such a run is watched and published like one of SolveModel: it can
+// be interrupted through the monitor, is profiled with source "ranging",
+// and becomes the model's last result and a cache entry. Throws for models
+// with integer variables and for runs that end without a simplex basis.
+HighsRangingResult RangeModel(HighsModelInfo &model_info,
+                              const HighsThreadSettings &settings,
+                              HighsRunMonitor *monitor = nullptr);
+
+// Size of a model read from or written to a file
+struct HighsModelFileStats {
+  idx_t num_columns = 0;
+  idx_t num_rows = 0;
+  idx_t num_nonzeros = 0;
+};
+
+// Parse a 'continuous' / 'integer' / 'binary' type name
+HighsVariableType ParseVariableType(const char *data, idx_t size);
+inline HighsVariableType ParseVariableType(const string_t &var_type) {
+  return ParseVariableType(var_type.GetData(), var_type.GetSize());
+}
+inline HighsVariableType ParseVariableType(const std::string &var_type) {
+  return ParseVariableType(var_type.data(), var_type.size());
+}
+
+// Map a variable type onto HiGHS
+inline HighsVarType ToHighsVarType(HighsVariableType var_type) {
+  return var_type == HighsVariableType::CONTINUOUS ? HighsVarType::kContinuous
+                                                   : HighsVarType::kInteger;
+}
+
+// Set HiGHS integrality from variable types, clamping binary variables to
+// [0, 1]
+void SetIntegrality(const std::vector<HighsVariableType> &variable_types,
+                    HighsLp &lp);
+
+} // namespace duckdb
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "duckdb.hpp"
+
+// HiGHS headers
+#include "Highs.h"
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <vector>
+
+namespace duckdb {
+
+// Progress and cancellation of one HiGHS run, shared between the thread
+// running it and the threads watching it (progress bar, highs_jobs). HiGHS
+// reports through its callbacks; anyone may request a stop, which HiGHS
+// honours at its next interrupt check.
+class HighsRunMonitor {
+public:
+  HighsRunMonitor();
+
+  void Cancel() { cancel_requested = true; }
+  bool CancelRequested() const {
+    return cancel_requested || (interrupt_flag && *interrupt_flag);
+  }
+
+  // Also stop when this flag is raised, e.g. ClientContext::interrupted
+  void WatchInterrupt(const std::atomic<bool> *flag) { interrupt_flag = flag; }
+
+  // Size of the run: the LP columns and rows, and the time_limit option.
+  // Call right before the run; SolverStarted() counts from here.
+  void Start(idx_t num_columns, idx_t num_rows, double time_limit);
+
+  // Receives every improved MIP incumbent: objective, gap, seconds since
+  // the run started and the column values. Called on the solving thread;
+  // set it before the run.
+  using SolutionListener = std::function<void(
+      double objective, double gap, double elapsed, std::vector<double>)>;
+  void ListenForSolutions(SolutionListener listener) {
+    solution_listener = std::move(listener);
+  }
+
+  // Estimated fraction of the run done, in [0, 1]. A MIP goes by its gap,
+  // an LP by simplex iterations against a guess of a few per row; a time
+  // limit caps the remaining time either way.
+  double Progress() const;
+
+  // Best objective found so far and the relative MIP gap, NaN until HiGHS
+  // reports them
+  double Objective() const { return objective; }
+  double Gap() const { return gap; }
+  // Seconds HiGHS has been running, as of its last callback
+  double Elapsed() const { return elapsed; }
+  // Seconds from Start() to the first callback from a solver (simplex, IPM
+  // or MIP), which HiGHS only makes once presolve is done; NaN if there was
+  // none
+  double SolverStarted() const { return solver_started; }
+
+  // Called from the HiGHS callbacks
+  void ReportSolverActivity();
+  void ReportIncumbent(double objective_value);
+  bool WantsSolutions() const { return bool(solution_listener); }
+  idx_t NumColumns() const { return columns; }
+  void ReportSolution(std::vector<double> values);
+  void ReportGap(double mip_gap);
+  void ReportIterations(int64_t simplex_iterations, double running_time);
+
+private:
+  std::atomic<bool> cancel_requested{false};
+  const std::atomic<bool> *interrupt_flag = nullptr;
+  std::atomic<double> objective;
+  std::atomic<double> gap;
+  std::atomic<int64_t> iterations{0};
+  std::atomic<double> elapsed{0};
+  std::atomic<idx_t> columns{0};
+  std::atomic<idx_t> rows{0};
+  SolutionListener solution_listener;
+  std::atomic<double> time_limit;
+  std::chrono::steady_clock::time_point start_time;
+  std::atomic<double> solver_started;
+};
+
+// Routes a Highs instance's callbacks to a monitor while in scope. The
+// callbacks are removed again on exit, as instances outlive single runs.
+class HighsMonitorScope {
+public:
+  HighsMonitorScope(Highs &highs, HighsRunMonitor &monitor);
+  ~HighsMonitorScope();
+
+  HighsMonitorScope(const HighsMonitorScope &) = delete;
+  HighsMonitorScope &operator=(const HighsMonitorScope &) = delete;
+
+private:
+  Highs &highs;
+};
+
+} // namespace duckdb
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "highs_model.hpp"
+
+#include <string>
+
+namespace duckdb {
+
+// Parse an MPS file straight into the arrays of an empty model. The file
+// is streamed through DuckDB's FileSystem, so compressed (.gz) and remote
+// files work, and only one read buffer is held besides the model itself.
+// Free format is assumed, as in the HiGHS reader: names must not contain
+// spaces. Supports OBJSENSE, RANGES, integer MARKERs and the UP, LO, FX,
+// FR, MI, PL, BV, LI and UI bounds. N rows after the first (the objective)
+// become free constraints. The arrays are charged to the model's
+// model_memory as they grow. The caller must hold the model mutex
+// exclusively; on error the model is left empty.
+HighsModelFileStats ReadMpsModel(ClientContext &context,
+                                 const std::string &path,
+                                 HighsModelInfo &model_info);
+
+// Write the model as free MPS, gzip-compressed if the path ends in .gz.
+// Id-keyed models get C<id> and R<id> names; names that are empty or
+// contain whitespace are rejected before the file is created. Free
+// constraints are written as N rows and bounds of magnitude 1e30 or more as
+// infinite. The caller must hold the model mutex, shared or exclusive.
+HighsModelFileStats WriteMpsModel(ClientContext &context,
+                                  const std::string &path,
+                                  const std::string &model_name,
+                                  const HighsModelInfo &model_info);
+
+} // namespace duckdb
@@ -0,0 +1,177 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "duckdb/common/types/vector_buffer.hpp"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace duckdb {
+
+// Capacity to grow to so there is room for count elements: at least double
+// the current one. Loaders reserve room batch by batch, and an exact
+// reserve would copy everything loaded so far on every batch.
+inline idx_t GrownCapacity(idx_t capacity, idx_t count) {
+  return count <= capacity ? capacity : MaxValue<idx_t>(count, 2 * capacity);
+}
+
+template <class T> void ReserveGrown(std::vector<T> &values, idx_t count) {
+  values.reserve(GrownCapacity(values.capacity(), count));
+}
+
+// Bytes ReserveGrown(values, count) would add
+template <class T>
+idx_t ReserveGrownBytes(const std::vector<T> &values, idx_t count) {
+  return (GrownCapacity(values.capacity(), count) - values.capacity()) *
+         sizeof(T);
+}
+
+// Power-of-two slot count of an open-addressing table that keeps count
+// keys at most 3/4 full, growing from capacity
+inline idx_t SlotCapacity(idx_t capacity, idx_t count) {
+  while (count * 4 > capacity * 3) {
+    capacity *= 2;
+  }
+  return capacity;
+}
+
+// Owns the bytes of interned names. Blocks never move, so string_t values
+// pointing into them stay valid for as long as the arena lives. It is a
+// VectorBuffer so output vectors can hold on to it while they reference
+// names without copying them.
+class HighsNameArena : public VectorBuffer {
+public:
+  HighsNameArena() : VectorBuffer(VectorBufferType::OPAQUE_BUFFER) {}
+
+  // Copy size bytes into the arena and return the stable copy
+  const char *Add(const char *data, idx_t size);
+
+  idx_t AllocatedBytes() const { return allocated_bytes; }
+
+private:
+  static constexpr idx_t kBlockSize = 256 * 1024;
+
+  std::vector<unique_ptr<char[]>> blocks;
+  char *current_block = nullptr;
+  idx_t block_used = kBlockSize;
+  idx_t allocated_bytes = 0;
+};
+
+// Names of a model's variables or constraints, each stored once and
+// numbered in insertion order. Names up to string_t::INLINE_LENGTH bytes
+// live inside their string_t; longer ones are copied into the arena.
+// Lookups go through an open-addressing table of 64-bit slots holding a
+// hash tag and the name's index, probed linearly.
+class HighsNameTable {
+public:
+  HighsNameTable();
+
+  idx_t Size() const { return names.size(); }
+
+  // Index of the name, or -1 if it is not in the table
+  int Find(const char *data, idx_t size) const;
+  int Find(const string_t &name) const {
+    return Find(name.GetData(), name.GetSize());
+  }
+  int Find(const std::string &name) const {
+    return Find(name.data(), name.size());
+  }
+
+  // Add the name under the next index and return that index, or -1 if the
+  // name is already present
+  int Insert(const char *data, idx_t size);
+  int Insert(const string_t &name) {
+    return Insert(name.GetData(), name.GetSize());
+  }
+  int Insert(const std::string &name) {
+    return Insert(name.data(), name.size());
+  }
+
+  void Reserve(idx_t count);
+  // Bytes Reserve(count) would add, not counting the arena
+  idx_t ReserveBytes(idx_t count) const {
+    return ReserveGrownBytes(names, count) +
+           (SlotCapacity(slots.size(), count) - slots.size()) *
+               sizeof(uint64_t);
+  }
+
+  const string_t &Get(idx_t index) const { return names[index]; }
+  std::string GetString(idx_t index) const { return names[index].GetString(); }
+
+  // All names in index order, and the arena their bytes live in
+  const std::vector<string_t> &Names() const { return names; }
+  const buffer_ptr<HighsNameArena> &Arena() const { return arena; }
+
+  // Bytes held by the names, the lookup table and the arena
+  idx_t AllocatedBytes() const {
+    return names.capacity() * sizeof(string_t) +
+           slots.capacity() * sizeof(uint64_t) + arena->AllocatedBytes();
+  }
+
+private:
+  static constexpr uint64_t kEmptySlot = 0;
+
+  // Slot layout: upper 32 bits hash tag, lower 32 bits index + 1
+  static uint64_t MakeSlot(hash_t hash, idx_t index) {
+    return (hash & 0xFFFFFFFF00000000ULL) | (uint64_t)(index + 1);
+  }
+
+  void Rehash(idx_t capacity);
+
+  buffer_ptr<HighsNameArena> arena;
+  std::vector<string_t> names;
+  std::vector<uint64_t> slots; // power-of-two sized, at most 3/4 full
+};
+
+// BIGINT keys of a model's variables or constraints, for models loaded by
+// id instead of by name. Any BIGINT is a valid id, so sparse keys such as
+// hashes or epochs cost no more than dense ones. Lookups go through an
+// open-addressing table of index + 1 slots, probed linearly and compared
+// against the ids array, as HighsNameTable does for names.
+class HighsIdMap {
+public:
+  HighsIdMap();
+
+  idx_t Size() const { return ids.size(); }
+
+  // Index of the id, or -1 if it is not in the map
+  int Find(int64_t id) const;
+
+  // Add the id under the next index and return that index, or -1 if the id
+  // is already present
+  int Insert(int64_t id);
+
+  void Reserve(idx_t count);
+  // Bytes Reserve(count) would add
+  idx_t ReserveBytes(idx_t count) const {
+    return ReserveGrownBytes(ids, count) +
+           (SlotCapacity(slots.size(), count) - slots.size()) *
+               sizeof(uint32_t);
+  }
+
+  int64_t Get(idx_t index) const { return ids[index]; }
+  const std::vector<int64_t> &Ids() const { return ids; }
+
+  idx_t AllocatedBytes() const {
+    return slots.capacity() * sizeof(uint32_t) +
+           ids.capacity() * sizeof(int64_t);
+  }
+
+private:
+  static constexpr uint32_t kEmptySlot = 0;
+
+  void Rehash(idx_t capacity);
+
+  std::vector<uint32_t> slots; // power-of-two sized, at most 3/4 full
+  std::vector<int64_t> ids;    // by index
+};
+
+// Keep the arena alive for as long as the vector references its names.
+// Call once per output chunk, then assign the string_t values directly.
+void AttachNameArena(Vector &vector, const buffer_ptr<HighsNameArena> &arena);
+
+// Write "<name>_<index>" into a string vector entry
+string_t FormatIndexedName(Vector &vector, const string_t &name, idx_t index);
+
+} // namespace duckdb
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/function/table_function.hpp"
+
+#include <vector>
+
+namespace duckdb {
+
+// Columns of the solution functions, which emit one row per model column
+// or, for highs_solve_constraints, one row per model row
+enum class HighsSolveColumn : uint8_t {
+  VARIABLE_NAME,
+  VARIABLE_INDEX, // "<name>_<index>", kept for existing queries
+  VARIABLE_ID,
+  SOLUTION_VALUE,
+  REDUCED_COST,
+  COLUMN_INDEX, // HiGHS column index
+  CONSTRAINT_NAME,
+  CONSTRAINT_ID,
+  ROW_ACTIVITY,
+  DUAL_VALUE,
+  SLACK,
+  ROW_INDEX, // HiGHS row index
+  STATUS
+};
+
+// What a solution scan reports
+enum class HighsSolveOutput : uint8_t {
+  VARIABLES,    // highs_solve, highs_solve_tables
+  VARIABLE_IDS, // highs_solve_ids
+  CONSTRAINTS   // highs_solve_constraints
+};
+
+// Output schema of a solution scan. The last column is the HiGHS column or
+// row index, which also serves the row id.
+const std::vector<HighsSolveColumn> &SolveSchema(HighsSolveOutput output);
+
+// Add the schema's columns to a bind's return types and names
+void SetSolveSchema(const std::vector<HighsSolveColumn> &schema,
+                    vector<LogicalType> &return_types, vector<string> &names);
+
+LogicalType SolveColumnType(HighsSolveColumn column);
+
+// The columns a scan actually produces, and the filters pushed into it.
+// DuckDB only asks for the projected columns (plus any a filter needs), so
+// each output vector maps onto one entry of Columns(). Filters pushed down
+// are not re-checked by DuckDB, so every emitted chunk goes through Filter.
+class HighsSolveProjection {
+public:
+  void Initialize(ClientContext &context, const TableFunctionInitInput &input,
+                  const std::vector<HighsSolveColumn> &schema);
+
+  const std::vector<HighsSolveColumn> &Columns() const { return columns; }
+
+  // Drop the rows of a filled chunk that fail the pushed-down filters
+  void Filter(DataChunk &chunk);
+
+private:
+  std::vector<HighsSolveColumn> columns;
+  unique_ptr<Expression> filter_expression;
+  unique_ptr<ExpressionExecutor> filter;
+  SelectionVector selection;
+};
+
+} // namespace duckdb
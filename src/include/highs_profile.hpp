@@ -0,0 +1,110 @@
+#pragma once
+
+#include "duckdb.hpp"
+
+// HiGHS headers
+#include "Highs.h"
+
+#include <chrono>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace duckdb {
+
+struct HighsModelInfo;
+class HighsRunMonitor;
+
+// Wall-clock time since construction, for the profile timings
+class HighsStopwatch {
+public:
+  HighsStopwatch() : start(std::chrono::steady_clock::now()) {}
+
+  double Seconds() const {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                         start)
+        .count();
+  }
+
+private:
+  std::chrono::steady_clock::time_point start;
+};
+
+// Where a solve's time went and what HiGHS reported for it. Times are in
+// seconds; NaN where a phase was not measured for this kind of solve.
+struct HighsSolveProfile {
+  uint64_t solve_id = 0;
+  std::string source = "solve"; // "solve", "cache", "decomposed", "ranging"
+  HighsModelStatus model_status = HighsModelStatus::kNotset;
+  double objective_value = 0.0;
+
+  double assembly_time = 0.0;   // model arrays into a HighsLp
+  double pass_model_time = 0.0; // passModel, or the deltas to a live solver
+  double presolve_time = 0.0;   // run start to the first solver callback
+  double solve_time = 0.0;      // the rest of the run
+  double emission_time = 0.0;   // result scans, summed over all of them
+
+  int64_t simplex_iterations = 0;
+  int64_t ipm_iterations = 0;
+  int64_t crossover_iterations = 0;
+  int64_t mip_nodes = 0;
+  int64_t presolve_removed_rows = 0;
+  int64_t presolve_removed_columns = 0;
+  bool mip = false;
+  double mip_gap = 0.0; // final relative gap, for MIPs only
+};
+
+// Fill the run timings and HiGHS counters of a profile after highs.run(),
+// from the monitor the run was watched by and its wall time
+void RecordRunProfile(const Highs &highs, const HighsRunMonitor &monitor,
+                      double run_time, HighsSolveProfile &profile);
+
+// Profiles of a model's most recent solves, oldest first. It has its own
+// lock, so scans can add their emission time after the model locks are
+// released.
+class HighsSolveLog {
+public:
+  static constexpr idx_t kMaxEntries = 64;
+
+  // Keep the profile under the next solve id, dropping the oldest beyond
+  // kMaxEntries, and return the id
+  uint64_t Record(HighsSolveProfile profile);
+
+  // Add to the emission time of a solve still in the log
+  void AddEmission(uint64_t solve_id, double seconds);
+
+  std::vector<HighsSolveProfile> Entries();
+
+private:
+  std::mutex mutex;
+  std::deque<HighsSolveProfile> entries;
+  uint64_t next_solve_id = 1;
+};
+
+// Size of a model and the bytes held by each of its structures, as reported
+// by highs_model_stats
+struct HighsModelStats {
+  idx_t num_variables = 0;
+  idx_t num_constraints = 0;
+  idx_t num_nonzeros = 0;
+  idx_t num_integer = 0; // integer and binary variables
+
+  idx_t variable_key_bytes = 0;   // variable names or ids
+  idx_t constraint_key_bytes = 0; // constraint names or ids
+  idx_t objective_bytes = 0;
+  idx_t bound_bytes = 0; // variable and constraint bounds
+  idx_t coefficient_bytes = 0;
+  idx_t type_bytes = 0;
+  // The live solver's copy of the LP and the last result; unknown while a
+  // solve of the model is running, as they belong to it until it ends
+  bool solver_known = false;
+  idx_t solver_bytes = 0;
+  idx_t result_bytes = 0;
+};
+
+// Takes the model mutex shared, and solver_mutex only if it is free, so it
+// never waits on a running solve
+HighsModelStats ComputeModelStats(HighsModelInfo &model_info);
+
+} // namespace duckdb
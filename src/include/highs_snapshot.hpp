@@ -0,0 +1,39 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "highs_model.hpp"
+
+#include <string>
+
+namespace duckdb {
+
+// Binary snapshots of registered models. A snapshot holds the model arrays
+// as they sit in memory: column and row data as dense arrays, the
+// constraint matrix row-wise (start, index, value), names as a length array
+// plus one byte blob, or the BIGINT ids, the option profile and, if
+// given, a simplex basis. Arrays are stored in native byte order behind a
+// versioned header, so loading is a bulk read per array plus rebuilding
+// the name index.
+
+// Write the model to path. The caller must hold the model mutex, shared or
+// exclusive; basis may be null.
+HighsModelFileStats SaveModelSnapshot(ClientContext &context,
+                                      const std::string &path,
+                                      const HighsModelInfo &model_info,
+                                      const HighsBasis *basis);
+HighsModelFileStats SaveModelSnapshot(FileSystem &fs, const std::string &path,
+                                      const HighsModelInfo &model_info,
+                                      const HighsBasis *basis);
+
+// Load a snapshot into an empty model, including its key type, options and
+// basis. The arrays are charged to the model's model_memory, sized from
+// the header, before they are read. The caller must hold the model mutex
+// exclusively; throws on malformed or foreign files, leaving the model
+// empty.
+HighsModelFileStats LoadModelSnapshot(ClientContext &context,
+                                      const std::string &path,
+                                      HighsModelInfo &model_info);
+HighsModelFileStats LoadModelSnapshot(FileSystem &fs, const std::string &path,
+                                      HighsModelInfo &model_info);
+
+} // namespace duckdb
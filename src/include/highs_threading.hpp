@@ -0,0 +1,80 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "duckdb/main/config.hpp"
+
+// HiGHS headers
+#include "Highs.h"
+
+#include <map>
+#include <string>
+
+namespace duckdb {
+
+// Per-model HiGHS options set through highs_set_option, by option name
+using HighsOptionProfile = std::map<std::string, std::string>;
+
+// Check that HiGHS accepts the option and value, throwing if it does not
+void ValidateHighsOption(const std::string &name, const std::string &value);
+
+// Reset the instance to default options and apply the profile. The
+// 'threads' entry is left to HighsSolveSlot, which owns the pool size.
+void ApplyHighsOptions(Highs &highs, const HighsOptionProfile &profile);
+
+// Validate a value for the highs_threading setting
+void SetHighsThreadingMode(ClientContext &context, SetScope scope,
+                           Value &parameter);
+
+// The settings a solve sizes HiGHS threads from, captured from a client
+// context so solves that outlive the query (background jobs) can use them
+struct HighsThreadSettings {
+  std::string mode = "auto"; // highs_threading
+  idx_t duckdb_threads = 1;
+
+  static HighsThreadSettings FromContext(ClientContext &context);
+};
+
+// Threads a solve admitted now may use, by the highs_threading setting:
+//   'auto'   - DuckDB threads minus one for every other solve in flight
+//              (counted process-wide, and at least concurrent_solves - 1
+//              for callers about to start several at once), so callers
+//              blocked in HiGHS plus its workers stay within the DuckDB
+//              threads setting; a profile's 'threads' caps it
+//   'duckdb' - one, leaving parallelism to the DuckDB workers that run
+//              independent solves side by side
+//   'highs'  - the HiGHS default of half the hardware threads
+// Model assembly ahead of a solve uses the same budget.
+idx_t HighsSolveWidth(const HighsThreadSettings &settings,
+                      const HighsOptionProfile &profile,
+                      idx_t concurrent_solves = 1);
+
+// Admits one HiGHS run while it is in scope, with HighsSolveWidth threads
+// as counted when the slot is acquired.
+//
+// HiGHS runs its parallel work on a single process-wide worker pool whose
+// size is fixed until the pool is reset, and every run must ask for that
+// same size. The pool is sized to the width while no solve is running. A
+// solve admitted while others are in flight joins the current pool; if its
+// width is smaller, it runs with parallel simplex off (width one) or its
+// simplex concurrency capped at the width.
+class HighsSolveSlot {
+public:
+  HighsSolveSlot(ClientContext &context, Highs &highs,
+                 const HighsOptionProfile &profile,
+                 idx_t concurrent_solves = 1);
+  HighsSolveSlot(const HighsThreadSettings &settings, Highs &highs,
+                 const HighsOptionProfile &profile,
+                 idx_t concurrent_solves = 1);
+  ~HighsSolveSlot();
+
+  // Threads this solve was admitted with
+  idx_t Width() const { return width; }
+
+  HighsSolveSlot(const HighsSolveSlot &) = delete;
+  HighsSolveSlot &operator=(const HighsSolveSlot &) = delete;
+
+private:
+  idx_t width = 1;
+};
+
+} // namespace duckdb